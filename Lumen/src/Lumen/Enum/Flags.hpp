@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "Lumen/Internal/Enum/Flags.hpp"
+
+namespace Lumen::Enum
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Public functions
+    ////////////////////////////////////////////////////////////////////////////////////
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr const auto& Values() // Note: Bitwise enums only return their single-bit values
+    {
+        if constexpr (Lumen::Enum::Customize<TEnum>::Bitwise)
+            return Lumen::Internal::Enum::SingleBitValues<TEnum>;
+        else
+            return Lumen::Internal::Enum::Values<TEnum>;
+    }
+
+    template<BitwiseEnum TEnum>
+    constexpr Lumen::Internal::Enum::FlagRange<TEnum> Flags(const TEnum value) // Note: Iterates over the set bits, without allocating
+    {
+        return Lumen::Internal::Enum::FlagRange<TEnum>(value);
+    }
+
+}
\ No newline at end of file
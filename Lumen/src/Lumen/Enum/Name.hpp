@@ -2,8 +2,10 @@
 
 #include <cstdint>
 #include <utility>
+#include <optional>
 
 #include "Lumen/Internal/Enum/Name.hpp"
+#include "Lumen/Internal/Enum/Lookup.hpp"
 
 namespace Lumen::Enum
 {
@@ -12,17 +14,15 @@ namespace Lumen::Enum
     // Public functions
     ////////////////////////////////////////////////////////////////////////////////////
     template<typename TEnum> requires(std::is_enum_v<TEnum>)
-    constexpr std::string_view Name(const TEnum value) // Note: This function doesn't need to optimized, since it should only be used during Debug builds.
+    constexpr std::string_view Name(const TEnum value) // Note: Returns an empty string for values that aren't reflected, including combined bitwise flags
     {
-        constexpr const auto entries = Lumen::Internal::Enum::Entries<TEnum>;
-        
-        for (const auto& [val, name] : entries)
-        {
-            if (val == value)
-                return name;
-        }
+        return Lumen::Internal::Enum::LookupName(value);
+    }
 
-        return "";
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr std::optional<TEnum> Cast(std::string_view name) // Note: The name is the element name without the enum's name, ex. "First" for Dummy::First
+    {
+        return Lumen::Internal::Enum::LookupValue<TEnum>(name);
     }
 
 }
\ No newline at end of file
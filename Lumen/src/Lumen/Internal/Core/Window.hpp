@@ -38,6 +38,7 @@ namespace Lumen::Internal
 
 		// Methods
 		forceinline void PollEvents() { m_Window.PollEvents(); }
+		forceinline void DispatchEvents() { m_Window.DispatchEvents(); }
 		forceinline void SwapBuffers() { m_Window.SwapBuffers(); }
 
 		// Note: This is not resizing the window, it's resizing the drawing area (on the internal renderer).
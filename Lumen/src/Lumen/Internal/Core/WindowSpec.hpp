@@ -1,17 +1,17 @@
 #pragma once
 
 #include <cstdint>
-#include <functional>
 #include <string_view>
 
 #include "Lumen/Core/Events.hpp"
 
 #include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Memory/InplaceFunction.hpp"
 
 namespace Lumen::Internal
 {
 
-    using EventCallbackFn = std::function<void(Event e)>;
+    using EventCallbackFn = InplaceFunction<void(Event& e)>; // Note: Never allocates, captures must fit in the inline storage
 
     ////////////////////////////////////////////////////////////////////////////////////
     // WindowSpecification
@@ -22,8 +22,10 @@ namespace Lumen::Internal
         // Window
         std::string_view Title = {};
         uint32_t Width = 0, Height = 0;
+        bool Visible = true; // Note: Hidden windows still get a surface & swapchain, used to run the renderer headless
 
         EventCallbackFn EventCallback = nullptr;
+        bool ThreadedInput = false; // Note: If true, PollEvents only queues events & DispatchEvents must be called (from any single thread) to deliver them
 
         // Renderer
         bool VSync = false;
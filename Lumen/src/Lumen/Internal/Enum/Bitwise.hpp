@@ -6,21 +6,6 @@
 #include <cstdint>
 #include <type_traits>
 
-namespace Lumen::Enum
-{
-
-    ////////////////////////////////////////////////////////////////////////////////////
-    // Bitwise
-    ////////////////////////////////////////////////////////////////////////////////////
-    template<typename TEnum> requires(std::is_enum_v<TEnum>)
-    struct Customize
-    {
-    public:
-		inline static constexpr bool Bitwise = false;
-    };
-
-}
-
 ////////////////////////////////////////////////////////////////////////////////////
 // BitwiseEnum
 ////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <bit>
+#include <array>
+#include <format>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+
+#include "Lumen/Internal/Enum/Name.hpp"
+#include "Lumen/Internal/Enum/Lookup.hpp"
+#include "Lumen/Internal/Enum/Bitwise.hpp"
+
+namespace Lumen::Internal::Enum
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // FlagIterator
+    ////////////////////////////////////////////////////////////////////////////////////
+    template<BitwiseEnum TEnum>
+    class FlagIterator // Note: Yields every set bit as a single-bit value, from low to high
+    {
+    public:
+        using U = std::make_unsigned_t<std::underlying_type_t<TEnum>>;
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TEnum;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = TEnum;
+    public:
+        // Constructors & Destructor
+        constexpr FlagIterator() = default;
+        constexpr FlagIterator(U bits)
+            : m_Bits(bits) {}
+        constexpr ~FlagIterator() = default;
+
+        // Operators
+        constexpr TEnum operator * () const { return static_cast<TEnum>(static_cast<U>(m_Bits & (~m_Bits + 1))); }
+
+        constexpr FlagIterator& operator ++ () { m_Bits &= static_cast<U>(m_Bits - 1); return *this; }
+        constexpr FlagIterator operator ++ (int) { FlagIterator copy = *this; ++(*this); return copy; }
+
+        constexpr bool operator == (const FlagIterator& other) const = default;
+
+    private:
+        U m_Bits = 0;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // FlagRange
+    ////////////////////////////////////////////////////////////////////////////////////
+    template<BitwiseEnum TEnum>
+    class FlagRange
+    {
+    public:
+        using U = typename FlagIterator<TEnum>::U;
+    public:
+        // Constructors & Destructor
+        constexpr FlagRange(TEnum value)
+            : m_Bits(static_cast<U>(value)) {}
+        constexpr ~FlagRange() = default;
+
+        // Methods
+        constexpr FlagIterator<TEnum> begin() const { return FlagIterator<TEnum>(m_Bits); }
+        constexpr FlagIterator<TEnum> end() const { return FlagIterator<TEnum>(); }
+
+        // Getters
+        constexpr size_t size() const { return static_cast<size_t>(std::popcount(m_Bits)); }
+        constexpr bool empty() const { return (m_Bits == 0); }
+
+    private:
+        U m_Bits;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Single-bit values
+    ////////////////////////////////////////////////////////////////////////////////////
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr auto SingleBitValuesImpl()
+    {
+        using U = std::make_unsigned_t<std::underlying_type_t<TEnum>>;
+        constexpr auto count = static_cast<size_t>(std::count_if(Values<TEnum>.begin(), Values<TEnum>.end(), [](TEnum value) { return std::has_single_bit(static_cast<U>(value)); }));
+
+        std::array<TEnum, count> values = {};
+        std::copy_if(Values<TEnum>.begin(), Values<TEnum>.end(), values.begin(), [](TEnum value) { return std::has_single_bit(static_cast<U>(value)); });
+
+        return values;
+    }
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    inline constexpr auto SingleBitValues = SingleBitValuesImpl<TEnum>();
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Formatter
+////////////////////////////////////////////////////////////////////////////////////
+// Note: Formats as "Sampled | Storage", unnamed bits as hex and 0 as its name or "0"
+template<BitwiseEnum TEnum>
+struct std::formatter<TEnum>
+{
+public:
+    constexpr auto parse(std::format_parse_context& ctx)
+    {
+        if ((ctx.begin() != ctx.end()) && (*ctx.begin() != '}'))
+            throw std::format_error("Bitwise enums don't support format specifiers.");
+
+        return ctx.begin();
+    }
+
+    template<typename TContext>
+    auto format(TEnum value, TContext& ctx) const
+    {
+        using U = std::make_unsigned_t<std::underlying_type_t<TEnum>>;
+        auto out = ctx.out();
+
+        if (static_cast<U>(value) == 0)
+        {
+            std::string_view name = Lumen::Internal::Enum::LookupName(value);
+            return (name.empty() ? std::format_to(out, "0") : std::ranges::copy(name, out).out);
+        }
+
+        bool first = true;
+        for (TEnum flag : Lumen::Internal::Enum::FlagRange<TEnum>(value))
+        {
+            if (!first)
+                out = std::ranges::copy(std::string_view(" | "), out).out;
+            first = false;
+
+            std::string_view name = Lumen::Internal::Enum::LookupName(flag);
+            if (name.empty())
+                out = std::format_to(out, "{:#x}", static_cast<U>(flag));
+            else
+                out = std::ranges::copy(name, out).out;
+        }
+
+        return out;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <bit>
+#include <array>
+#include <limits>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <algorithm>
+#include <type_traits>
+
+#include "Lumen/Internal/Enum/Name.hpp"
+#include "Lumen/Internal/Enum/Bitwise.hpp"
+
+#include "Lumen/Internal/Utils/Hash.hpp"
+
+namespace Lumen::Internal::Enum
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Settings
+    ////////////////////////////////////////////////////////////////////////////////////
+    inline constexpr const size_t DenseFactor = 4; // Note: A dense table may be at most this many times larger than the amount of values
+    inline constexpr const size_t MaxSeeds = 4096; // Note: Seeds tried per bucket before giving up, only reached with duplicate keys
+    inline constexpr const uint16_t NoEntry = std::numeric_limits<uint16_t>::max();
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // PerfectHash
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Hash & displace, keys are split into buckets and every bucket gets a seed that places all of its keys in free slots.
+    //       Lookups are two hashes and two loads, no probing.
+    template<size_t N>
+    struct PerfectHash
+    {
+    public:
+        inline static constexpr const size_t BucketCount = std::bit_ceil(std::max<size_t>(N, 1));
+        inline static constexpr const size_t TableSize = BucketCount * 2;
+
+        static_assert((N < NoEntry), "Too many keys for a perfect hash table.");
+    public:
+        std::array<uint16_t, BucketCount> Seeds = { };
+        std::array<uint16_t, TableSize> Indices = { };
+        bool Valid = false; // Note: False if no seed was found for a bucket, which means keys were duplicated
+
+    public:
+        // Methods
+        constexpr uint16_t Find(size_t key) const // Note: Returns NoEntry or the index of the key that might match
+        {
+            return Indices[Slot(key, Seeds[Bucket(key)])];
+        }
+
+        // Static methods
+        constexpr static size_t Bucket(size_t key)
+        {
+            return Hash::Combine(key, 0) & (BucketCount - 1);
+        }
+
+        constexpr static size_t Slot(size_t key, size_t seed) // Note: Combine only mixes the high bits of its second argument, so the seed goes into the first
+        {
+            return Hash::Combine(key + (seed + 1) * 0x9e3779b97f4a7c15ull, 0) & (TableSize - 1);
+        }
+    };
+
+    template<size_t N>
+    constexpr PerfectHash<N> BuildPerfectHash(const std::array<size_t, N>& keys)
+    {
+        using Table = PerfectHash<N>;
+
+        Table table = {};
+        table.Indices.fill(NoEntry);
+
+        // Sort the keys by bucket, so every bucket's keys are contiguous
+        std::array<size_t, Table::BucketCount> buckets = {};
+        std::array<size_t, Table::BucketCount + 1> starts = {};
+        std::array<uint16_t, N> members = {};
+
+        for (size_t key : keys)
+            starts[Table::Bucket(key) + 1]++;
+        for (size_t i = 0; i < Table::BucketCount; i++)
+            starts[i + 1] += starts[i];
+
+        std::array<size_t, Table::BucketCount + 1> offsets = starts;
+        for (size_t i = 0; i < N; i++)
+            members[offsets[Table::Bucket(keys[i])]++] = static_cast<uint16_t>(i);
+
+        // Note: The largest buckets are placed first, while most slots are still free
+        for (size_t i = 0; i < Table::BucketCount; i++)
+            buckets[i] = i;
+        std::sort(buckets.begin(), buckets.end(), [&](size_t lhs, size_t rhs) { return (starts[lhs + 1] - starts[lhs]) > (starts[rhs + 1] - starts[rhs]); });
+
+        for (size_t bucket : buckets)
+        {
+            size_t begin = starts[bucket], end = starts[bucket + 1];
+            if (begin == end)
+                break;
+
+            bool placed = false;
+            for (size_t seed = 0; (seed < MaxSeeds) && !placed; seed++)
+            {
+                placed = true;
+                for (size_t i = begin; (i < end) && placed; i++)
+                {
+                    size_t slot = Table::Slot(keys[members[i]], seed);
+                    placed = (table.Indices[slot] == NoEntry);
+
+                    // Note: Also rejects slots taken by earlier keys of the same bucket
+                    for (size_t j = begin; (j < i) && placed; j++)
+                        placed = (Table::Slot(keys[members[j]], seed) != slot);
+                }
+
+                if (placed)
+                {
+                    for (size_t i = begin; i < end; i++)
+                        table.Indices[Table::Slot(keys[members[i]], seed)] = members[i];
+
+                    table.Seeds[bucket] = static_cast<uint16_t>(seed);
+                }
+            }
+
+            if (!placed)
+                return table;
+        }
+
+        table.Valid = true;
+        return table;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Keys
+    ////////////////////////////////////////////////////////////////////////////////////
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr int64_t Underlying(const TEnum value)
+    {
+        return static_cast<int64_t>(static_cast<std::underlying_type_t<TEnum>>(value));
+    }
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr auto ValueKeys()
+    {
+        std::array<size_t, Entries<TEnum>.size()> keys = {};
+        for (size_t i = 0; i < keys.size(); i++)
+            keys[i] = static_cast<size_t>(Underlying(Entries<TEnum>[i].first));
+
+        return keys;
+    }
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr auto NameKeys()
+    {
+        std::array<size_t, Entries<TEnum>.size()> keys = {};
+        for (size_t i = 0; i < keys.size(); i++)
+            keys[i] = Hash::fnv1a(Entries<TEnum>[i].second);
+
+        return keys;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Value to name
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Values are sorted, so the span is the distance between the first and last entry
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    inline constexpr size_t Span = static_cast<size_t>(Underlying(Entries<TEnum>.back().first) - Underlying(Entries<TEnum>.front().first)) + 1;
+
+    // Note: Bitwise enums are always sparse, since their combinations are not reflected
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    inline constexpr bool IsDense = !BitwiseEnum<TEnum> && (Span<TEnum> <= Entries<TEnum>.size() * DenseFactor);
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr auto DenseNamesImpl()
+    {
+        std::array<std::string_view, Span<TEnum>> names = {};
+        names.fill("");
+
+        for (const auto& [value, name] : Entries<TEnum>)
+            names[static_cast<size_t>(Underlying(value) - Underlying(Entries<TEnum>.front().first))] = name;
+
+        return names;
+    }
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    inline constexpr auto DenseNames = DenseNamesImpl<TEnum>();
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    inline constexpr auto ValueHash = BuildPerfectHash(ValueKeys<TEnum>());
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr std::string_view LookupName(const TEnum value)
+    {
+        if constexpr (IsDense<TEnum>)
+        {
+            int64_t offset = Underlying(value) - Underlying(Entries<TEnum>.front().first);
+            if ((offset < 0) || (offset >= static_cast<int64_t>(Span<TEnum>)))
+                return "";
+
+            return DenseNames<TEnum>[static_cast<size_t>(offset)];
+        }
+        else
+        {
+            static_assert(ValueHash<TEnum>.Valid, "Failed to find a perfect hash for the enum's values.");
+
+            uint16_t index = ValueHash<TEnum>.Find(static_cast<size_t>(Underlying(value)));
+            if ((index == NoEntry) || (Entries<TEnum>[index].first != value))
+                return "";
+
+            return Entries<TEnum>[index].second;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Name to value
+    ////////////////////////////////////////////////////////////////////////////////////
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    inline constexpr auto NameHash = BuildPerfectHash(NameKeys<TEnum>());
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr std::optional<TEnum> LookupValue(std::string_view name)
+    {
+        static_assert(NameHash<TEnum>.Valid, "Failed to find a perfect hash for the enum's names.");
+
+        uint16_t index = NameHash<TEnum>.Find(Hash::fnv1a(name));
+        if ((index == NoEntry) || (Entries<TEnum>[index].second != name))
+            return std::nullopt;
+
+        return Entries<TEnum>[index].first;
+    }
+
+}
\ No newline at end of file
@@ -31,6 +31,13 @@ namespace Lumen::Enum
         static_assert((Max - Min <= std::numeric_limits<uint16_t>::max()), "[Max - Min] must not exceed uint16 max value.");
     };
 
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    struct Customize
+    {
+    public:
+        inline static constexpr bool Bitwise = false; // Note: Bitwise enums only reflect 0 and single bits, the Range is ignored
+    };
+
 }
 
 namespace Lumen::Internal::Enum
@@ -40,6 +47,19 @@ namespace Lumen::Internal::Enum
     // Global values
     ////////////////////////////////////////////////////////////////////////////////////
     constexpr const std::string_view g_InvalidName = "1nvalid";
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Internal helpers
+    ////////////////////////////////////////////////////////////////////////////////////
+    constexpr bool IsCast(std::string_view value) // Note: Values without a name are printed as a cast, ex. (Dummy)10 or (enum Dummy)0xa
+    {
+        auto close = value.rfind(')');
+        if ((close == std::string_view::npos) || (close + 1 >= value.size()))
+            return false;
+
+        char next = value[close + 1];
+        return (next == '-') || ((next >= '0') && (next <= '9'));
+    }
     
     ////////////////////////////////////////////////////////////////////////////////////
     // Internal naming
@@ -156,7 +176,13 @@ namespace Lumen::Internal::Enum
             if constexpr (end - start <= 2)
                 return g_InvalidName;
 
-            return std::string_view(__PRETTY_FUNCTION__).substr(start + 2, end - start - 2);
+            constexpr std::string_view fullName = std::string_view(__PRETTY_FUNCTION__).substr(start + 2, end - start - 2);
+
+            // Cast (not a valid enum name, ex. (Dummy)10 instead of Dummy::First)
+            if constexpr (IsCast(fullName))
+                return g_InvalidName;
+
+            return fullName;
         }
 
         constexpr static std::string_view ElementNameImpl()
@@ -207,11 +233,81 @@ namespace Lumen::Internal::Enum
         return ConstexprName<TEnum, EValue>::ElementName;
     }
 
+    // Note: Only parses the value out of the signature, without instantiating ConstexprName. Used if the values can't be parsed out of a pack (see AreValid)
     template<typename TEnum, TEnum EValue> requires(std::is_enum_v<TEnum>)
     constexpr bool IsValid()
     {
-        constexpr TEnum value = static_cast<TEnum>(EValue);
-        return !Name<TEnum, value>().empty();
+        #if defined(LU_COMPILER_MSVC)
+            constexpr std::string_view signature = __FUNCSIG__;
+            constexpr auto end = signature.rfind('>');
+            constexpr auto start = signature.rfind(',', end) + 1;
+        #else
+            constexpr std::string_view signature = __PRETTY_FUNCTION__;
+            constexpr auto start = signature.rfind("EValue = ") + std::string_view("EValue = ").size();
+            constexpr auto end = signature.find_first_of(";]", start);
+        #endif
+
+        return !IsCast(signature.substr(start, end - start));
+    }
+
+    // Note: Splits a printed pack, ex. {Dummy::First, (Dummy)1} or <Dummy::First, (Dummy)1>, returns std::nullopt if it doesn't contain N values
+    template<size_t N>
+    constexpr std::optional<std::array<bool, N>> ParseValidPack(std::string_view signature, std::string_view token)
+    {
+        auto open = signature.rfind(token);
+        if ((open == std::string_view::npos) || (open + token.size() >= signature.size()))
+            return std::nullopt;
+
+        std::array<bool, N> valid = {};
+        size_t count = 0;
+        size_t depth = 0;
+        size_t element = open + token.size() + 1; // Note: Skips the opening bracket
+
+        for (size_t i = element; i < signature.size(); i++)
+        {
+            char c = signature[i];
+            bool close = ((c == ')') || (c == '>') || (c == '}'));
+
+            if ((c == '(') || (c == '<') || (c == '{'))
+                depth++;
+            else if (close && (depth > 0))
+                depth--;
+            else if ((c == ',') || close)
+            {
+                std::string_view value = signature.substr(element, i - element);
+                value.remove_prefix(std::min(value.find_first_not_of(' '), value.size()));
+
+                if (!value.empty())
+                {
+                    if (count == N)
+                        return std::nullopt;
+
+                    valid[count++] = !IsCast(value);
+                }
+
+                if (close)
+                    return ((count == N) ? std::optional<std::array<bool, N>>(valid) : std::nullopt);
+
+                element = i + 1;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    // Note: Checks a whole pack with one instantiation, since a function per value is what makes reflection slow to compile
+    template<typename TEnum, TEnum... EValues> requires(std::is_enum_v<TEnum>)
+    constexpr std::array<bool, sizeof...(EValues)> AreValid()
+    {
+        #if defined(LU_COMPILER_MSVC)
+            return { IsValid<TEnum, EValues>()... };
+        #else
+            constexpr auto valid = ParseValidPack<sizeof...(EValues)>(__PRETTY_FUNCTION__, "EValues = ");
+            if constexpr (valid.has_value())
+                return *valid;
+            else
+                return { IsValid<TEnum, EValues>()... };
+        #endif
     }
 
     template<typename TEnum> requires(std::is_enum_v<TEnum>)
@@ -220,35 +316,79 @@ namespace Lumen::Internal::Enum
         return static_cast<TEnum>(Lumen::Enum::Range<TEnum>::Min + v);
     }
 
-    template<size_t N>
-    constexpr size_t CountValues(const bool (&valid)[N])
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr TEnum UFlag(size_t v) // Note: 0 for v == 0, otherwise bit (v - 1)
     {
-        size_t count = 0;
-        for (size_t n = 0; n < N; n++) 
-        {
-            if (valid[n])
-                ++count;
-        }
+        using U = std::make_unsigned_t<std::underlying_type_t<TEnum>>;
+        return static_cast<TEnum>((v == 0) ? U(0) : static_cast<U>(U(1) << (v - 1)));
+    }
 
-        return count;
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr TEnum Candidate(size_t v)
+    {
+        if constexpr (Lumen::Enum::Customize<TEnum>::Bitwise)
+            return UFlag<TEnum>(v);
+        else
+            return UAlue<TEnum>(v);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
     // Values
     ////////////////////////////////////////////////////////////////////////////////////
+    inline constexpr const size_t ChunkSize = 64; // Note: Values are checked in chunks, to keep pack expansions small
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    inline constexpr size_t RangeSize = static_cast<size_t>(Lumen::Enum::Range<TEnum>::Max - Lumen::Enum::Range<TEnum>::Min + 1);
+
+    template<typename TEnum, size_t Offset, size_t... I> requires(std::is_enum_v<TEnum>)
+    constexpr std::array<bool, sizeof...(I)> ValidChunkImpl(std::index_sequence<I...>)
+    {
+        return AreValid<TEnum, UAlue<TEnum>(Offset + I)...>();
+    }
+
+    // Note: A variable template, so every chunk is only evaluated once per enum
+    template<typename TEnum, size_t Offset> requires(std::is_enum_v<TEnum>)
+    inline constexpr auto ValidChunk = ValidChunkImpl<TEnum, Offset>(std::make_index_sequence<std::min(ChunkSize, RangeSize<TEnum> - Offset)>());
+
+    template<typename TEnum, size_t... C> requires(std::is_enum_v<TEnum>)
+    constexpr std::array<bool, RangeSize<TEnum>> ValidImpl(std::index_sequence<C...>)
+    {
+        std::array<bool, RangeSize<TEnum>> valid = {};
+        ((std::copy(ValidChunk<TEnum, C * ChunkSize>.begin(), ValidChunk<TEnum, C * ChunkSize>.end(), valid.begin() + C * ChunkSize)), ...);
+
+        return valid;
+    }
+
     template<typename TEnum, size_t... I> requires(std::is_enum_v<TEnum>)
-    constexpr auto ValuesImpl(std::index_sequence<I...>)
+    constexpr std::array<bool, sizeof...(I)> ValidFlagsImpl(std::index_sequence<I...>)
+    {
+        return AreValid<TEnum, UFlag<TEnum>(I)...>();
+    }
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr auto ValidImpl()
     {
-        constexpr bool valid[sizeof...(I)] = { IsValid<TEnum, UAlue<TEnum>(I)>()... };
-        constexpr auto validCount = CountValues(valid);
+        if constexpr (Lumen::Enum::Customize<TEnum>::Bitwise)
+            return ValidFlagsImpl<TEnum>(std::make_index_sequence<sizeof(TEnum) * 8 + 1>());
+        else
+            return ValidImpl<TEnum>(std::make_index_sequence<(RangeSize<TEnum> + ChunkSize - 1) / ChunkSize>());
+    }
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    inline constexpr auto Valid = ValidImpl<TEnum>();
+
+    template<typename TEnum> requires(std::is_enum_v<TEnum>)
+    constexpr auto ValuesImpl()
+    {
+        constexpr auto validCount = static_cast<size_t>(std::count(Valid<TEnum>.begin(), Valid<TEnum>.end(), true));
         static_assert(validCount > 0, "No support for empty enums."); 
 
         std::array<TEnum, validCount> values = {};
         for (size_t offset = 0, n = 0; n < validCount; offset++) 
         {
-            if (valid[offset]) 
+            if (Valid<TEnum>[offset]) 
             {
-                values[n] = UAlue<TEnum>(offset);
+                values[n] = Candidate<TEnum>(offset);
                 ++n;
             }
         }
@@ -256,13 +396,6 @@ namespace Lumen::Internal::Enum
         return values;
     }
 
-    template<typename TEnum> requires(std::is_enum_v<TEnum>)
-    constexpr auto ValuesImpl()
-    {
-        constexpr auto enumSize = Lumen::Enum::Range<TEnum>::Max - Lumen::Enum::Range<TEnum>::Min + 1;
-        return ValuesImpl<TEnum>(std::make_index_sequence<enumSize>({}));
-    }
-
     template<typename TEnum> requires(std::is_enum_v<TEnum>)
     inline constexpr auto Values = ValuesImpl<TEnum>();
 
@@ -0,0 +1,249 @@
+#include "lupch.h"
+#include "BinaryLog.hpp"
+
+#include "Lumen/Internal/IO/Print.hpp"
+
+#include <mutex>
+#include <thread>
+
+#if defined(LU_PLATFORM_WINDOWS)
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+#endif
+
+namespace
+{
+
+    using namespace Lumen::Internal::Log;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // State
+    ////////////////////////////////////////////////////////////////////////////////////
+    static std::mutex s_Lock = {}; // Note: Protects opening, closing & the format registry, never taken by Write
+
+    static std::vector<std::string> s_Formats = { };
+
+    static std::byte* s_Memory = nullptr;
+    static uint64_t s_Capacity = 0;
+
+    alignas(64) static std::atomic<uint64_t> s_Offset = 0;
+    alignas(64) static std::atomic<uint32_t> s_Writers = 0; // Note: Writes in progress, so Close doesn't unmap underneath them
+
+    #if defined(LU_PLATFORM_WINDOWS)
+    static HANDLE s_File = INVALID_HANDLE_VALUE;
+    static HANDLE s_Mapping = nullptr;
+    #else
+    static int s_File = -1;
+    #endif
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Mapping
+    ////////////////////////////////////////////////////////////////////////////////////
+    static bool Map(std::string_view path, uint64_t capacity)
+    {
+        std::string file = std::string(path);
+
+        #if defined(LU_PLATFORM_WINDOWS)
+        s_File = CreateFileA(file.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (s_File == INVALID_HANDLE_VALUE)
+            return false;
+
+        s_Mapping = CreateFileMappingA(s_File, nullptr, PAGE_READWRITE, static_cast<DWORD>(capacity >> 32), static_cast<DWORD>(capacity & 0xFFFFFFFF), nullptr);
+        if (s_Mapping)
+            s_Memory = static_cast<std::byte*>(MapViewOfFile(s_Mapping, FILE_MAP_ALL_ACCESS, 0, 0, static_cast<SIZE_T>(capacity)));
+
+        if (!s_Memory)
+        {
+            if (s_Mapping)
+                CloseHandle(s_Mapping);
+            CloseHandle(s_File);
+
+            s_Mapping = nullptr;
+            s_File = INVALID_HANDLE_VALUE;
+            return false;
+        }
+        #else
+        s_File = open(file.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (s_File < 0)
+            return false;
+
+        // Note: The file is zero filled, which the decoder relies on to find the end
+        void* memory = MAP_FAILED;
+        if (ftruncate(s_File, static_cast<off_t>(capacity)) == 0)
+            memory = mmap(nullptr, static_cast<size_t>(capacity), PROT_READ | PROT_WRITE, MAP_SHARED, s_File, 0);
+
+        if (memory == MAP_FAILED)
+        {
+            close(s_File);
+            s_File = -1;
+            return false;
+        }
+
+        s_Memory = static_cast<std::byte*>(memory);
+        #endif
+
+        s_Capacity = capacity;
+        return true;
+    }
+
+    static void Unmap(uint64_t used)
+    {
+        #if defined(LU_PLATFORM_WINDOWS)
+        FlushViewOfFile(s_Memory, 0);
+        UnmapViewOfFile(s_Memory);
+        CloseHandle(s_Mapping);
+
+        LARGE_INTEGER size = {};
+        size.QuadPart = static_cast<LONGLONG>(used);
+        SetFilePointerEx(s_File, size, nullptr, FILE_BEGIN);
+        SetEndOfFile(s_File);
+        CloseHandle(s_File);
+
+        s_Mapping = nullptr;
+        s_File = INVALID_HANDLE_VALUE;
+        #else
+        msync(s_Memory, static_cast<size_t>(s_Capacity), MS_SYNC);
+        munmap(s_Memory, static_cast<size_t>(s_Capacity));
+
+        // Note: Keeps the zeroed terminator record if there's room for it
+        (void)ftruncate(s_File, static_cast<off_t>(used));
+        close(s_File);
+
+        s_File = -1;
+        #endif
+
+        s_Memory = nullptr;
+        s_Capacity = 0;
+    }
+
+}
+
+namespace Lumen::Internal::Log
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool BinaryLog::Open(std::string_view path, uint64_t capacity)
+    {
+        Close();
+
+        std::scoped_lock<std::mutex> lock(s_Lock);
+
+        capacity = (capacity + 7) & ~static_cast<uint64_t>(7);
+        if (capacity < sizeof(Binary::FileHeader) + sizeof(Binary::RecordHeader)) [[unlikely]]
+        {
+            LU_LOG_ERROR("[BinaryLog] Capacity of {0} bytes is too small.", capacity);
+            return false;
+        }
+
+        if (!Map(path, capacity))
+        {
+            LU_LOG_ERROR("[BinaryLog] Failed to map '{0}'.", path);
+            return false;
+        }
+
+        Binary::FileHeader header = {};
+        std::memcpy(header.Magic, Binary::Magic, sizeof(header.Magic));
+        header.Version = Binary::Version;
+        header.HeaderSize = sizeof(Binary::FileHeader);
+        header.Capacity = capacity;
+        std::memcpy(s_Memory, &header, sizeof(header));
+
+        s_Offset.store(sizeof(Binary::FileHeader), std::memory_order_relaxed);
+        s_Dropped.store(0, std::memory_order_relaxed);
+        s_Open.store(true, std::memory_order_release);
+
+        // Note: Formats registered before opening still need to be decodable
+        for (uint32_t i = 0; i < static_cast<uint32_t>(s_Formats.size()); i++)
+            WriteFormat(i, s_Formats[i]);
+
+        return true;
+    }
+
+    void BinaryLog::Close()
+    {
+        std::scoped_lock<std::mutex> lock(s_Lock);
+
+        if (!s_Open.exchange(false))
+            return;
+
+        while (s_Writers.load() != 0)
+            std::this_thread::yield();
+
+        Unmap(std::min(s_Offset.load(std::memory_order_relaxed) + sizeof(Binary::RecordHeader), s_Capacity));
+
+        if (s_Dropped.load(std::memory_order_relaxed) > 0)
+            LU_LOG_WARN("[BinaryLog] Dropped {0} records, since the file was full.", s_Dropped.load(std::memory_order_relaxed));
+    }
+
+    uint32_t BinaryLog::Register(std::string_view format)
+    {
+        std::scoped_lock<std::mutex> lock(s_Lock);
+
+        uint32_t id = static_cast<uint32_t>(s_Formats.size());
+        s_Formats.emplace_back(format);
+
+        if (s_Open.load(std::memory_order_acquire))
+            WriteFormat(id, format);
+
+        return id;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    std::byte* BinaryLog::Reserve(uint32_t size)
+    {
+        // Note: Sequentially consistent, pairs with Close so either it waits for us or we see it closed
+        s_Writers.fetch_add(1);
+
+        if (!s_Open.load()) [[unlikely]]
+        {
+            s_Writers.fetch_sub(1, std::memory_order_release);
+            return nullptr;
+        }
+
+        uint64_t offset = s_Offset.fetch_add(size, std::memory_order_relaxed);
+        if (offset + size > s_Capacity) [[unlikely]]
+        {
+            s_Dropped.fetch_add(1, std::memory_order_relaxed);
+            s_Writers.fetch_sub(1, std::memory_order_release);
+            return nullptr;
+        }
+
+        // Note: Written right away, so the decoder can skip the record if it's never committed
+        std::byte* record = s_Memory + offset;
+        reinterpret_cast<Binary::RecordHeader*>(record)->Length = size;
+        return record;
+    }
+
+    void BinaryLog::Commit(std::byte* record, uint32_t size)
+    {
+        // Note: The size is published last, so a reader never sees a partially written record
+        std::atomic_ref<uint32_t>(reinterpret_cast<Binary::RecordHeader*>(record)->Size).store(size, std::memory_order_release);
+        s_Writers.fetch_sub(1, std::memory_order_release);
+    }
+
+    void BinaryLog::WriteFormat(uint32_t id, std::string_view format)
+    {
+        format = format.substr(0, std::numeric_limits<uint16_t>::max());
+        uint32_t size = Binary::Align(static_cast<uint32_t>(sizeof(Binary::RecordHeader) + sizeof(uint32_t) + format.size()));
+
+        std::byte* record = Reserve(size);
+        if (!record) [[unlikely]]
+            return;
+
+        Binary::RecordHeader header = { .Length = size, .Size = 0, .Type = Binary::RecordType::Format, .Count = static_cast<uint16_t>(format.size()) };
+
+        std::byte* dst = Binary::Put(record, &header, sizeof(header));
+        dst = Binary::Put(dst, &id, sizeof(id));
+        Binary::Put(dst, format.data(), format.size());
+
+        Commit(record, size);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Lumen/Core/Core.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Lumen::Internal::Log
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Binary format
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: The file is a FileHeader followed by 8 byte aligned records. A record's Length is
+    // written when it's reserved & its Size once it's complete, so a record that was never
+    // completed (e.g. after a crash) has a Size of 0 & can be skipped using its Length.
+    namespace Binary
+    {
+        inline constexpr const char Magic[8] = { 'L', 'U', 'B', 'L', 'O', 'G', '\0', '\0' };
+        inline constexpr const uint32_t Version = 2;
+
+        enum class RecordType : uint16_t { Format = 1, Message };
+        enum class ArgumentType : uint8_t { Bool = 0, Char, Int, UInt, Float, Pointer, String, Null };
+
+        struct FileHeader
+        {
+        public:
+            char Magic[8] = {};
+            uint32_t Version = 0;
+            uint32_t HeaderSize = 0;
+            uint64_t Capacity = 0; // Note: Size of the file, including the header
+        };
+
+        struct RecordHeader
+        {
+        public:
+            uint32_t Length = 0; // Note: Including the header & padding, written when reserved
+            uint32_t Size = 0; // Note: Equal to Length, written last
+            RecordType Type = RecordType::Format;
+            uint16_t Count = 0; // Note: Amount of arguments (Message) or the length of the string (Format)
+        };
+
+        // Record payloads:
+        // - Format: uint32_t id, char[Count]
+        // - Message: uint32_t id, uint64_t timestamp (nanoseconds since the epoch), Count * (ArgumentType, value)
+        //   with a value being 1 byte for Bool & Char, 8 bytes for Int, UInt, Float & Pointer, uint32_t length + char[length] for String
+        //   and nothing for Null (a null C string)
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLog
+    ////////////////////////////////////////////////////////////////////////////////////
+    class BinaryLog // Note: Lock-free sink that writes format ids & raw arguments to a memory-mapped file, decode it with the LogDecoder tool
+    {
+    public:
+        // Settings
+        inline constexpr static const uint64_t DefaultCapacity = 64ull * 1024 * 1024;
+    public:
+        // Static methods
+        static bool Open(std::string_view path, uint64_t capacity = DefaultCapacity); // Note: Also writes every format registered so far
+        static void Close(); // Note: Waits for writes in progress & trims the file to its used size
+
+        static uint32_t Register(std::string_view format); // Note: Call once per call site, the LU_LOG_BINARY macro caches the id
+
+        template<typename ...TArgs>
+        static void Write(uint32_t id, std::format_string<TArgs...> fmt, TArgs&&... args); // Note: The format string is only used to validate the arguments at compile time
+
+        forceinline static bool IsOpen() { return s_Open.load(std::memory_order_relaxed); }
+        forceinline static uint64_t GetDropped() { return s_Dropped.load(std::memory_order_relaxed); } // Note: Records that didn't fit in the file
+
+    private:
+        // Private methods
+        static std::byte* Reserve(uint32_t size); // Note: Returns nullptr if the sink is closed or full, otherwise Commit must be called
+        static void Commit(std::byte* record, uint32_t size);
+        static void WriteFormat(uint32_t id, std::string_view format);
+
+        template<typename T>
+        static uint32_t GetSize(const T& arg);
+        template<typename T>
+        static std::byte* Encode(std::byte* dst, const T& arg);
+
+    private:
+        inline static std::atomic<bool> s_Open = false;
+        inline static std::atomic<uint64_t> s_Dropped = 0;
+    };
+
+}
+
+#include "Lumen/Internal/IO/BinaryLog.inl"
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "BinaryLog.hpp"
+
+#include <chrono>
+
+namespace Lumen::Internal::Log
+{
+
+    namespace Binary
+    {
+        template<typename T>
+        concept StringLike = std::is_convertible_v<const T&, std::string_view>;
+
+        forceinline constexpr uint32_t Align(uint32_t size) { return (size + 7u) & ~7u; }
+
+        forceinline std::byte* Put(std::byte* dst, const void* src, size_t size)
+        {
+            std::memcpy(dst, src, size);
+            return dst + size;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    template<typename ...TArgs>
+    hintinline void BinaryLog::Write(uint32_t id, std::format_string<TArgs...>, TArgs&&... args)
+    {
+        static_assert((sizeof...(TArgs) <= std::numeric_limits<uint16_t>::max()), "[BinaryLog] Too many arguments.");
+
+        // Note: Types without a raw encoding are formatted on the calling thread
+        auto convert = []<typename T>(T&& arg) -> decltype(auto)
+        {
+            using Type = std::remove_cvref_t<T>;
+            if constexpr (std::is_arithmetic_v<Type> || std::is_pointer_v<Type> || Binary::StringLike<Type>)
+                return std::forward<T>(arg);
+            else
+                return std::format("{}", arg);
+        };
+
+        auto write = [id](const auto&... values)
+        {
+            uint32_t size = Binary::Align(static_cast<uint32_t>(sizeof(Binary::RecordHeader) + sizeof(uint32_t) + sizeof(uint64_t)) + (0u + ... + GetSize(values)));
+
+            std::byte* record = Reserve(size);
+            if (!record) [[unlikely]]
+                return;
+
+            Binary::RecordHeader header = { .Length = size, .Size = 0, .Type = Binary::RecordType::Message, .Count = static_cast<uint16_t>(sizeof...(values)) };
+            uint64_t timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+            std::byte* dst = Binary::Put(record, &header, sizeof(header));
+            dst = Binary::Put(dst, &id, sizeof(id));
+            dst = Binary::Put(dst, &timestamp, sizeof(timestamp));
+            ((dst = Encode(dst, values)), ...);
+
+            Commit(record, size);
+        };
+
+        write(convert(std::forward<TArgs>(args))...);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    hintinline uint32_t BinaryLog::GetSize(const T& arg)
+    {
+        using Type = std::remove_cvref_t<T>;
+
+        if constexpr (std::is_same_v<Type, bool> || std::is_same_v<Type, char>)
+            return 2;
+        else if constexpr (Binary::StringLike<Type>)
+        {
+            if constexpr (std::is_pointer_v<Type>)
+            {
+                if (!arg) [[unlikely]]
+                    return 1;
+            }
+
+            return static_cast<uint32_t>(1 + sizeof(uint32_t) + std::string_view(arg).size());
+        }
+        else
+            return 1 + 8;
+    }
+
+    template<typename T>
+    hintinline std::byte* BinaryLog::Encode(std::byte* dst, const T& arg)
+    {
+        using Type = std::remove_cvref_t<T>;
+
+        auto put = [&](Binary::ArgumentType type, const auto& value)
+        {
+            dst = Binary::Put(dst, &type, sizeof(type));
+            dst = Binary::Put(dst, &value, sizeof(value));
+        };
+
+        if constexpr (std::is_same_v<Type, bool>)
+            put(Binary::ArgumentType::Bool, static_cast<uint8_t>(arg));
+        else if constexpr (std::is_same_v<Type, char>)
+            put(Binary::ArgumentType::Char, arg);
+        else if constexpr (Binary::StringLike<Type>)
+        {
+            // Note: A null C string can't be viewed, so it's encoded as a type without a value
+            if constexpr (std::is_pointer_v<Type>)
+            {
+                if (!arg) [[unlikely]]
+                {
+                    Binary::ArgumentType type = Binary::ArgumentType::Null;
+                    return Binary::Put(dst, &type, sizeof(type));
+                }
+            }
+
+            std::string_view string = arg;
+            put(Binary::ArgumentType::String, static_cast<uint32_t>(string.size()));
+            dst = Binary::Put(dst, string.data(), string.size());
+        }
+        else if constexpr (std::is_floating_point_v<Type>)
+            put(Binary::ArgumentType::Float, static_cast<double>(arg));
+        else if constexpr (std::is_signed_v<Type>)
+            put(Binary::ArgumentType::Int, static_cast<int64_t>(arg));
+        else if constexpr (std::is_unsigned_v<Type>)
+            put(Binary::ArgumentType::UInt, static_cast<uint64_t>(arg));
+        else
+            put(Binary::ArgumentType::Pointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(arg)));
+
+        return dst;
+    }
+
+}
\ No newline at end of file
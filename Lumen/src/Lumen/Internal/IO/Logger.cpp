@@ -0,0 +1,300 @@
+#include "lupch.h"
+#include "Logger.hpp"
+
+#include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Utils/Profiler.hpp"
+
+#include <ctime>
+#include <mutex>
+#include <thread>
+#include <iostream>
+
+namespace
+{
+
+    using namespace Lumen::Internal;
+    using namespace Lumen::Internal::Log;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // State
+    ////////////////////////////////////////////////////////////////////////////////////
+    enum class State : uint8_t { Stopped = 0, Running, Shutdown };
+
+    static std::atomic<State> s_State = State::Stopped;
+    static std::once_flag s_StartFlag = {};
+    static std::mutex s_ThreadLock = {};
+    static std::thread* s_Thread = nullptr; // Note: A pointer so it's constant initialized & usable during static initialization, protected by s_ThreadLock
+    static std::atomic<std::thread::id> s_ThreadID = {}; // Note: Published separately, so Flush can check it without racing Shutdown
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Ring
+    ////////////////////////////////////////////////////////////////////////////////////
+    static Logger::Record s_Records[Logger::Capacity] = {};
+
+    inline constexpr static const size_t ClosedBit = (static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1)); // Note: Set on s_Tail at shutdown, so nothing can be claimed afterwards
+
+    alignas(Logger::CacheLineSize) static std::atomic<size_t> s_Tail = 0;      // Note: Next position to claim, shared by all producers
+    alignas(Logger::CacheLineSize) static std::atomic<size_t> s_Written = 0;   // Note: Amount of records written, only advanced by the background thread
+    static std::atomic<size_t> s_Head = 0;                                     // Note: Amount of records claimed before shutdown, which are all written before the thread exits
+
+    alignas(Logger::CacheLineSize) static std::atomic<bool> s_Sleeping = false;
+    static std::atomic<uint32_t> s_Signal = 0;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Output
+    ////////////////////////////////////////////////////////////////////////////////////
+    static std::mutex s_OutputLock = {};
+
+    // Note: The timestamp is only formatted again when the second changes, protected by s_OutputLock
+    static int64_t s_CachedTime = -1;
+    static char s_CachedTimestamp[16] = {};
+
+    forceinline std::string_view GetColour(Level level)
+    {
+        switch (level)
+        {
+        case Level::Trace:  return Log::Colour::Reset;
+        case Level::Info:   return Log::Colour::GreenFG;
+        case Level::Warn:   return Log::Colour::BrightYellowFG;
+        case Level::Error:  return Log::Colour::BrightRedFG;
+        case Level::Fatal:  return Log::Colour::RedBG;
+
+        default:
+            break;
+        }
+
+        return Log::Colour::Reset;
+    }
+
+    forceinline std::string_view GetTag(Level level)
+    {
+        switch (level)
+        {
+        case Level::Trace:  return LevelTag<Level::Trace>();
+        case Level::Info:   return LevelTag<Level::Info>();
+        case Level::Warn:   return LevelTag<Level::Warn>();
+        case Level::Error:  return LevelTag<Level::Error>();
+        case Level::Fatal:  return LevelTag<Level::Fatal>();
+
+        default:
+            break;
+        }
+
+        return "?";
+    }
+
+    forceinline void Wake()
+    {
+        // Note: Pairs with the fence in Logger::Run, so either the background thread sees our record or we see it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (s_Sleeping.load(std::memory_order_relaxed)) [[unlikely]]
+        {
+            s_Signal.fetch_add(1, std::memory_order_release);
+            s_Signal.notify_one();
+        }
+    }
+
+    struct ShutdownGuard
+    {
+    public:
+        ~ShutdownGuard() { Logger::Shutdown(); }
+    };
+
+}
+
+namespace Lumen::Internal::Log
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Static methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    Logger::Record* Logger::Claim()
+    {
+        State state = s_State.load(std::memory_order_acquire);
+        if (state != State::Running) [[unlikely]]
+        {
+            if (state == State::Shutdown)
+                return nullptr;
+
+            Start();
+        }
+
+        size_t position = s_Tail.load(std::memory_order_relaxed);
+        while (true)
+        {
+            if (position & ClosedBit) [[unlikely]]
+                return nullptr;
+
+            Record& record = s_Records[position & (Capacity - 1)];
+            size_t sequence = record.Sequence.load(std::memory_order_acquire);
+            intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            if (difference == 0)
+            {
+                if (s_Tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    record.Position = position;
+                    return &record;
+                }
+            }
+            else if (difference < 0) [[unlikely]] // Full
+            {
+                // Note: Once shut down the ring is never drained again, so the caller has to write directly
+                if (s_State.load(std::memory_order_acquire) == State::Shutdown)
+                    return nullptr;
+
+                Wake();
+                std::this_thread::yield();
+                position = s_Tail.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                position = s_Tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void Logger::Commit(Record& record, Level level, int64_t time, ApplyFn apply)
+    {
+        record.LogLevel = level;
+        record.Time = time;
+        record.Apply = apply;
+
+        record.Sequence.store(record.Position + 1, std::memory_order_release);
+        Wake();
+    }
+
+    void Logger::Flush()
+    {
+        if (s_State.load(std::memory_order_acquire) != State::Running)
+            return;
+
+        if (std::this_thread::get_id() == s_ThreadID.load(std::memory_order_acquire)) [[unlikely]]
+            return;
+
+        size_t target = (s_Tail.load(std::memory_order_acquire) & ~ClosedBit);
+        while (s_Written.load(std::memory_order_acquire) < target)
+        {
+            s_Signal.fetch_add(1, std::memory_order_release);
+            s_Signal.notify_one();
+            std::this_thread::yield();
+        }
+    }
+
+    void Logger::Write(Level level, int64_t time, std::string_view message)
+    {
+        LU_MEM_TAG(Logging);
+
+        std::scoped_lock<std::mutex> lock(s_OutputLock);
+
+        if (time != s_CachedTime)
+        {
+            std::time_t seconds = static_cast<std::time_t>(time);
+            std::tm local = {};
+            #if defined(LU_PLATFORM_WINDOWS)
+                localtime_s(&local, &seconds);
+            #else
+                localtime_r(&seconds, &local);
+            #endif
+
+            std::strftime(s_CachedTimestamp, sizeof(s_CachedTimestamp), "%H:%M:%S", &local);
+            s_CachedTime = time;
+        }
+
+        std::cout << GetColour(level) << '[' << s_CachedTimestamp << "] [" << GetTag(level) << "]: " << message << Colour::Reset << '\n';
+
+        if (level >= Level::Error)
+            std::cout.flush();
+    }
+
+    void Logger::Shutdown()
+    {
+        std::scoped_lock<std::mutex> lock(s_ThreadLock);
+
+        if ((s_State.load(std::memory_order_acquire) != State::Running) || !s_Thread)
+            return;
+
+        // Note: Closing the tail fixes the amount of claimed records, which the background thread writes before exiting
+        s_Head.store((s_Tail.fetch_or(ClosedBit, std::memory_order_acq_rel) & ~ClosedBit), std::memory_order_relaxed);
+
+        s_State.store(State::Shutdown, std::memory_order_release);
+        s_Signal.fetch_add(1, std::memory_order_release);
+        s_Signal.notify_one();
+
+        s_Thread->join();
+        delete s_Thread;
+        s_Thread = nullptr;
+
+        std::cout.flush();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void Logger::Start()
+    {
+        std::call_once(s_StartFlag, []()
+        {
+            for (size_t i = 0; i < Capacity; i++)
+                s_Records[i].Sequence.store(i, std::memory_order_relaxed);
+
+            // Note: Constructed on first use, so it's destroyed (and stops the thread) before anything constructed earlier
+            static ShutdownGuard s_ShutdownGuard = {};
+            (void)s_ShutdownGuard;
+
+            std::scoped_lock<std::mutex> lock(s_ThreadLock);
+            s_Thread = new std::thread(&Logger::Run);
+            s_ThreadID.store(s_Thread->get_id(), std::memory_order_release);
+            s_State.store(State::Running, std::memory_order_release);
+        });
+    }
+
+
+    void Logger::Run()
+    {
+        LU_MEM_TAG(Logging);
+
+        size_t position = 0;
+        std::string message = {};
+
+        while (true)
+        {
+            Record& record = s_Records[position & (Capacity - 1)];
+
+            if (record.Sequence.load(std::memory_order_acquire) == position + 1)
+            {
+                message.clear();
+                record.Apply(message, record.Arguments);
+                Write(record.LogLevel, record.Time, message);
+
+                record.Sequence.store(position + Capacity, std::memory_order_release);
+                position++;
+                s_Written.store(position, std::memory_order_release);
+                continue;
+            }
+
+            if (s_State.load(std::memory_order_acquire) == State::Shutdown)
+            {
+                // Note: Records claimed before shutdown may still be committing, wait for each of them
+                if (position < s_Head.load(std::memory_order_relaxed))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                break;
+            }
+
+            // Nothing to do, go to sleep until a producer wakes us
+            uint32_t signal = s_Signal.load(std::memory_order_acquire);
+            s_Sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if ((record.Sequence.load(std::memory_order_acquire) != position + 1) && (s_State.load(std::memory_order_acquire) != State::Shutdown))
+                s_Signal.wait(signal, std::memory_order_acquire);
+
+            s_Sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Lumen/Internal/Utils/Settings.hpp"
+
+#include "Lumen/Core/Core.hpp"
+
+#include <new>
+#include <tuple>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+namespace Lumen::Internal::Log
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Levels
+    ////////////////////////////////////////////////////////////////////////////////////
+    enum class Level : uint8_t { Trace, Info, Warn, Error, Fatal };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // DeferredArguments
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Strings are copied, since the caller's buffer may be gone by the time the message is formatted
+    template<typename T>
+    using StoredArgument = std::conditional_t<std::is_convertible_v<std::decay_t<T>, std::string_view>, std::string, std::decay_t<T>>;
+
+    template<typename ...TArgs>
+    struct DeferredArguments
+    {
+    public:
+        std::string_view Format;
+        std::tuple<TArgs...> Arguments;
+
+    public:
+        // Constructor & Destructor
+        template<typename ...Args>
+        forceinline DeferredArguments(std::string_view format, Args&&... args)
+            : Format(format), Arguments(std::forward<Args>(args)...) {}
+        ~DeferredArguments() = default;
+
+        // Static methods
+        static void Apply(std::string& out, std::byte* storage) // Note: Formats & destroys the arguments
+        {
+            DeferredArguments* arguments = std::launder(reinterpret_cast<DeferredArguments*>(storage));
+
+            std::apply([&](auto&... args) { std::vformat_to(std::back_inserter(out), arguments->Format, std::make_format_args(args...)); }, arguments->Arguments);
+            arguments->~DeferredArguments();
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Logger
+    ////////////////////////////////////////////////////////////////////////////////////
+    class Logger // Note: Messages are formatted & written on a background thread, producers only copy their arguments into a lock-free ring
+    {
+    public:
+        // Settings
+        inline constexpr static const size_t Capacity = 1024;     // Note: Producers spin when the ring is full
+        inline constexpr static const size_t ArgumentsSize = 192; // Note: Larger arguments are formatted on the calling thread
+        inline constexpr static const size_t CacheLineSize = 64;
+    public:
+        using ApplyFn = void(*)(std::string& out, std::byte* storage);
+
+        struct alignas(CacheLineSize) Record
+        {
+        public:
+            std::atomic<size_t> Sequence = 0;
+            size_t Position = 0;
+
+            Level LogLevel = Level::Trace;
+            int64_t Time = 0; // Note: In seconds since the epoch
+            ApplyFn Apply = nullptr;
+
+            alignas(std::max_align_t) std::byte Arguments[ArgumentsSize] = {};
+        };
+
+    public:
+        // Static methods
+        static Record* Claim(); // Note: Returns nullptr if the background thread isn't running (e.g. during static destruction)
+        static void Commit(Record& record, Level level, int64_t time, ApplyFn apply);
+
+        static void Flush(); // Note: Waits for all messages submitted before this call to be written
+        static void Write(Level level, int64_t time, std::string_view message); // Note: Writes directly, bypassing the queue
+        static void Shutdown(); // Note: Called at exit, messages after this are written directly
+
+        forceinline static int64_t Now() { return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count(); }
+
+    private:
+        // Private methods
+        static void Start();
+        static void Run();
+    };
+
+}
\ No newline at end of file
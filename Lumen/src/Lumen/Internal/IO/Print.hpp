@@ -2,6 +2,9 @@
 
 #include "Lumen/Internal/Utils/Settings.hpp"
 
+#include "Lumen/Internal/IO/Logger.hpp"
+#include "Lumen/Internal/IO/BinaryLog.hpp"
+
 #include "Lumen/Core/Core.hpp"
 
 #include <cstdint>
@@ -9,12 +12,8 @@
 #include <string>
 #include <string_view>
 #include <format>
-#include <chrono>
-#include <ctime>
 
 #include <iostream>
-#include <iomanip>
-#include <sstream>
 
 #if defined(LU_PLATFORM_WINDOWS)
     #include <intrin.h>
@@ -121,8 +120,6 @@ namespace Lumen::Internal
         ////////////////////////////////////////////////////////////////////////////////////
         // Levels
         ////////////////////////////////////////////////////////////////////////////////////
-		enum class Level : uint8_t { Trace, Info, Warn, Error, Fatal };
-        
         template<Level level>
         constexpr std::string_view LevelTag()
         {
@@ -141,42 +138,67 @@ namespace Lumen::Internal
         template<Level level, typename ...TArgs>
         void PrintLvl(std::format_string<TArgs...> fmt, TArgs&&... args)
         {
-            std::string time;
-            {
-                auto now = std::chrono::system_clock::now();
-                std::time_t nowTime = std::chrono::system_clock::to_time_t(now);
+            using Arguments = DeferredArguments<StoredArgument<TArgs>...>;
+            using Preformatted = DeferredArguments<std::string>;
 
-                std::ostringstream oss;
-                oss << std::put_time(std::localtime(&nowTime), "%H:%M:%S");
-                time = oss.str();
-            }
+            int64_t time = Logger::Now();
 
-            std::string message = std::format("[{0}] [{1}]: {2}", time, LevelTag<level>(), std::format(fmt, std::forward<TArgs>(args)...));
+            // Note: Fatal messages are written right away (after everything queued before them), since an assert breaks right after
+            if constexpr (level != Level::Fatal)
+            {
+                if (Logger::Record* record = Logger::Claim()) [[likely]]
+                {
+                    if constexpr ((sizeof(Arguments) <= Logger::ArgumentsSize) && (alignof(Arguments) <= alignof(std::max_align_t)))
+                    {
+                        new (record->Arguments) Arguments(fmt.get(), std::forward<TArgs>(args)...);
+                        Logger::Commit(*record, level, time, &Arguments::Apply);
+                    }
+                    else
+                    {
+                        new (record->Arguments) Preformatted("{}", std::format(fmt, std::forward<TArgs>(args)...));
+                        Logger::Commit(*record, level, time, &Preformatted::Apply);
+                    }
+                    return;
+                }
+            }
 
-            // Set colour
-            if constexpr (level == Level::Trace)
-                std::cout << Colour::Reset;
-            else if constexpr (level == Level::Info)
-                std::cout << Colour::GreenFG;
-            else if constexpr (level == Level::Warn)
-                std::cout << Colour::BrightYellowFG;
-            else if constexpr (level == Level::Error)
-                std::cout << Colour::BrightRedFG;
-            else if constexpr (level == Level::Fatal)
-                std::cout << Colour::RedBG;
-            
-            // Simulate PrintLn
-            Print(message);
-            std::cout << '\n';
+            Logger::Flush();
+            Logger::Write(level, time, std::format(fmt, std::forward<TArgs>(args)...));
         }
 
     };
 
+    // Note: Levels below LU_LOG_MIN_LEVEL compile to nothing, 0 = Trace, 1 = Info, 2 = Warn, 3 = Error (Fatal is always enabled).
+    //       Disabled macros expand to ((void)0), so `if (x) LU_LOG_TRACE(...);` doesn't become an empty body.
+    #if !defined(LU_LOG_MIN_LEVEL)
+        #if defined(LU_CONFIG_DEBUG)
+            #define LU_LOG_MIN_LEVEL 0
+        #else
+            #define LU_LOG_MIN_LEVEL 1
+        #endif
+    #endif
+
     #ifndef LU_CONFIG_DIST
-        #define LU_LOG_TRACE(...)       ::Lumen::Internal::Log::PrintLvl<::Lumen::Internal::Log::Level::Trace>(__VA_ARGS__)
-        #define LU_LOG_INFO(...)        ::Lumen::Internal::Log::PrintLvl<::Lumen::Internal::Log::Level::Info>(__VA_ARGS__)
-        #define LU_LOG_WARN(...)        ::Lumen::Internal::Log::PrintLvl<::Lumen::Internal::Log::Level::Warn>(__VA_ARGS__)
-        #define LU_LOG_ERROR(...)       ::Lumen::Internal::Log::PrintLvl<::Lumen::Internal::Log::Level::Error>(__VA_ARGS__)
+        #if LU_LOG_MIN_LEVEL <= 0
+            #define LU_LOG_TRACE(...)   ::Lumen::Internal::Log::PrintLvl<::Lumen::Internal::Log::Level::Trace>(__VA_ARGS__)
+        #else
+            #define LU_LOG_TRACE(...)   ((void)0)
+        #endif
+        #if LU_LOG_MIN_LEVEL <= 1
+            #define LU_LOG_INFO(...)    ::Lumen::Internal::Log::PrintLvl<::Lumen::Internal::Log::Level::Info>(__VA_ARGS__)
+        #else
+            #define LU_LOG_INFO(...)    ((void)0)
+        #endif
+        #if LU_LOG_MIN_LEVEL <= 2
+            #define LU_LOG_WARN(...)    ::Lumen::Internal::Log::PrintLvl<::Lumen::Internal::Log::Level::Warn>(__VA_ARGS__)
+        #else
+            #define LU_LOG_WARN(...)    ((void)0)
+        #endif
+        #if LU_LOG_MIN_LEVEL <= 3
+            #define LU_LOG_ERROR(...)   ::Lumen::Internal::Log::PrintLvl<::Lumen::Internal::Log::Level::Error>(__VA_ARGS__)
+        #else
+            #define LU_LOG_ERROR(...)   ((void)0)
+        #endif
         #define LU_LOG_FATAL(...)       ::Lumen::Internal::Log::PrintLvl<::Lumen::Internal::Log::Level::Fatal>(__VA_ARGS__)
 
         #define LU_ASSERT(x, msg)       \
@@ -199,14 +221,29 @@ namespace Lumen::Internal
             } while (false)
         
     #else
-        #define LU_LOG_TRACE(...) 
-        #define LU_LOG_INFO(...) 
-        #define LU_LOG_WARN(...) 
-        #define LU_LOG_ERROR(...) 
-        #define LU_LOG_FATAL(...) 
-
-        #define LU_ASSERT(x, msg)
-        #define LU_VERIFY(x, msg)
+        #define LU_LOG_TRACE(...) ((void)0)
+        #define LU_LOG_INFO(...) ((void)0)
+        #define LU_LOG_WARN(...) ((void)0)
+        #define LU_LOG_ERROR(...) ((void)0)
+        #define LU_LOG_FATAL(...) ((void)0)
+
+        #define LU_ASSERT(x, msg) ((void)0)
+        #define LU_VERIFY(x, msg) ((void)0)
+    #endif
+
+    // Note: Available in every configuration, only costs a relaxed load when no binary log is open (see BinaryLog::Open)
+    #if !defined(LU_DISABLE_BINARY_LOG)
+        #define LU_LOG_BINARY(fmt, ...)                                                                           \
+            do                                                                                                    \
+            {                                                                                                     \
+                if (::Lumen::Internal::Log::BinaryLog::IsOpen())                                                  \
+                {                                                                                                 \
+                    static const uint32_t s_BinaryLogFormatID = ::Lumen::Internal::Log::BinaryLog::Register(fmt); \
+                    ::Lumen::Internal::Log::BinaryLog::Write(s_BinaryLogFormatID, fmt __VA_OPT__(,) __VA_ARGS__); \
+                }                                                                                                 \
+            } while (false)
+    #else
+        #define LU_LOG_BINARY(fmt, ...)
     #endif
 
 }
\ No newline at end of file
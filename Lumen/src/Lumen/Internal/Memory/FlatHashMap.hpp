@@ -0,0 +1,250 @@
+#pragma once
+
+#include "Lumen/Core/Core.hpp"
+#include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Utils/Hash.hpp"
+#include "Lumen/Internal/Utils/Settings.hpp"
+
+#include <bit>
+#include <new>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+	#include <emmintrin.h>
+	#define LU_FLATHASHMAP_SSE2
+#endif
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// FlatHash<T>
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: Specialize this for cache keys and fold their members with Hash::Combine
+	template<typename T>
+	struct FlatHash
+	{
+	public:
+		forceinline size_t operator () (const T& value) const
+		{
+			if constexpr (std::is_pointer_v<T>)
+				return Hash::Combine(reinterpret_cast<uintptr_t>(value), 0);
+			else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+				return Hash::Combine(static_cast<size_t>(value), 0);
+			else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+				return Hash::Fast(std::string_view(value));
+			else if constexpr (std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>)
+				return Hash::Fast(value);
+			else
+				return Hash::Combine(std::hash<T>()(value), 0); // Note: std::hash is often the identity, the low bits need mixing
+		}
+	};
+
+	namespace FlatHashMapGroup
+	{
+
+		inline constexpr const size_t Width = 16;
+
+		inline constexpr const int8_t Empty = -128;  // Note: 0b10000000
+		inline constexpr const int8_t Deleted = -2;  // Note: 0b11111110
+		// Note: Full slots store the low 7 bits of their hash, so they're always >= 0
+
+		////////////////////////////////////////////////////////////////////////////////////
+		// Group
+		////////////////////////////////////////////////////////////////////////////////////
+		class Group // Note: Compares 16 control bytes at once, the masks have a bit set per matching slot
+		{
+		public:
+			// Constructor & Destructor
+			forceinline explicit Group(const int8_t* control)
+			{
+				#if defined(LU_FLATHASHMAP_SSE2)
+				m_Control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+				#else
+				for (size_t i = 0; i < Width; i++)
+					m_Control[i] = control[i];
+				#endif
+			}
+			~Group() = default;
+
+			// Methods
+			forceinline uint32_t Match(int8_t hash) const
+			{
+				#if defined(LU_FLATHASHMAP_SSE2)
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash), m_Control)));
+				#else
+				uint32_t mask = 0;
+				for (size_t i = 0; i < Width; i++)
+					mask |= static_cast<uint32_t>(m_Control[i] == hash) << i;
+				return mask;
+				#endif
+			}
+
+			forceinline uint32_t MatchEmpty() const { return Match(Empty); }
+
+			forceinline uint32_t MatchEmptyOrDeleted() const
+			{
+				#if defined(LU_FLATHASHMAP_SSE2)
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), m_Control)));
+				#else
+				uint32_t mask = 0;
+				for (size_t i = 0; i < Width; i++)
+					mask |= static_cast<uint32_t>(m_Control[i] < -1) << i;
+				return mask;
+				#endif
+			}
+
+		private:
+			#if defined(LU_FLATHASHMAP_SSE2)
+			__m128i m_Control;
+			#else
+			int8_t m_Control[Width];
+			#endif
+		};
+
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// FlatHashMap<TKey, TValue>
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename TKey, typename TValue, typename THash = FlatHash<TKey>, typename TEqual = std::equal_to<TKey>>
+	class FlatHashMap // Note: Open addressing (Swiss table), slots are stored inline & probed 16 control bytes at a time
+	{
+	public:
+		using Entry = std::pair<const TKey, TValue>;
+
+		inline constexpr static const size_t GroupWidth = FlatHashMapGroup::Width;
+		inline constexpr static const size_t MinCapacity = GroupWidth;
+		inline constexpr static const size_t MaxLoadNumerator = 7; // Note: Grows at a 7/8 load factor
+		inline constexpr static const size_t MaxLoadDenominator = 8;
+		inline constexpr static const size_t SlotAlignment = std::max(alignof(Entry), GroupWidth); // Note: Control bytes & slots share one allocation
+
+		////////////////////////////////////////////////////////////////////////////////////
+		// Iterator
+		////////////////////////////////////////////////////////////////////////////////////
+		template<bool Const>
+		class IteratorBase
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = Entry;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<Const, const Entry*, Entry*>;
+			using reference = std::conditional_t<Const, const Entry&, Entry&>;
+		public:
+			// Constructor & Destructor
+			IteratorBase() = default;
+			forceinline IteratorBase(const int8_t* control, pointer slot, const int8_t* end)
+				: m_Control(control), m_Slot(slot), m_End(end) { SkipEmpty(); }
+			forceinline IteratorBase(const IteratorBase<false>& other) requires(Const)
+				: m_Control(other.m_Control), m_Slot(other.m_Slot), m_End(other.m_End) {}
+			~IteratorBase() = default;
+
+			// Operators
+			forceinline reference operator * () const { return *m_Slot; }
+			forceinline pointer operator -> () const { return m_Slot; }
+
+			forceinline IteratorBase& operator ++ () { m_Control++; m_Slot++; SkipEmpty(); return *this; }
+			forceinline IteratorBase operator ++ (int) { IteratorBase copy = *this; ++(*this); return copy; }
+
+			forceinline bool operator == (const IteratorBase& other) const { return (m_Control == other.m_Control); }
+
+		private:
+			forceinline void SkipEmpty()
+			{
+				while ((m_Control != m_End) && (*m_Control < 0))
+				{
+					m_Control++;
+					m_Slot++;
+				}
+			}
+
+		private:
+			const int8_t* m_Control = nullptr;
+			pointer m_Slot = nullptr;
+			const int8_t* m_End = nullptr;
+
+			template<bool>
+			friend class IteratorBase;
+		};
+
+		using Iterator = IteratorBase<false>;
+		using ConstIterator = IteratorBase<true>;
+	public:
+		// Constructor & Destructor
+		FlatHashMap() = default;
+		explicit FlatHashMap(size_t capacity);
+		~FlatHashMap();
+
+		// Copy/Move constructors
+		FlatHashMap(const FlatHashMap&) = delete;
+		FlatHashMap(FlatHashMap&& other) noexcept;
+		FlatHashMap& operator = (const FlatHashMap&) = delete;
+		FlatHashMap& operator = (FlatHashMap&& other) noexcept;
+
+		// Operators
+		TValue& operator [] (const TKey& key) { return *Emplace(key).first; }
+
+		// Methods
+		template<typename ...Args>
+		std::pair<TValue*, bool> Emplace(const TKey& key, Args&& ...args); // Note: Returns the value & whether it was inserted, existing values are left untouched
+
+		TValue* Find(const TKey& key);
+		const TValue* Find(const TKey& key) const;
+		forceinline bool Contains(const TKey& key) const { return (Find(key) != nullptr); }
+
+		bool Erase(const TKey& key); // Note: Returns false if the key wasn't present
+		void Clear();                // Note: Keeps the capacity
+
+		void Reserve(size_t count);  // Note: Makes sure count entries fit without a rehash
+
+		// Iterators
+		forceinline Iterator begin() { return Iterator(m_Control, m_Slots, m_Control + m_Capacity); }
+		forceinline Iterator end() { return Iterator(m_Control + m_Capacity, m_Slots + m_Capacity, m_Control + m_Capacity); }
+		forceinline ConstIterator begin() const { return ConstIterator(m_Control, m_Slots, m_Control + m_Capacity); }
+		forceinline ConstIterator end() const { return ConstIterator(m_Control + m_Capacity, m_Slots + m_Capacity, m_Control + m_Capacity); }
+
+		// Getters
+		forceinline size_t Size() const { return m_Size; }
+		forceinline bool Empty() const { return (m_Size == 0); }
+		forceinline size_t Capacity() const { return m_Capacity; }
+
+	private:
+		// Private methods
+		forceinline static size_t H1(size_t hash) { return (hash >> 7); }
+		forceinline static int8_t H2(size_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+
+		forceinline static size_t MaxLoad(size_t capacity) { return (capacity / MaxLoadDenominator) * MaxLoadNumerator; }
+
+		size_t FindIndex(const TKey& key, size_t hash) const; // Note: Returns m_Capacity if not found
+		size_t FindInsertIndex(size_t hash) const;
+
+		void SetControl(size_t index, int8_t control);
+		void Rehash(size_t capacity);
+		void Destroy();
+
+		forceinline static size_t GetSlotOffset(size_t capacity) { return ((capacity + GroupWidth + SlotAlignment - 1) / SlotAlignment) * SlotAlignment; }
+
+	private:
+		int8_t* m_Control = nullptr; // Note: m_Capacity + GroupWidth bytes, the first group is mirrored at the end so groups can be loaded unaligned
+		Entry* m_Slots = nullptr;
+
+		size_t m_Capacity = 0;
+		size_t m_Size = 0;
+		size_t m_GrowthLeft = 0; // Note: Empty slots that can still be used before a rehash, tombstones don't count
+
+		[[no_unique_address]] THash m_Hash = {};
+		[[no_unique_address]] TEqual m_Equal = {};
+	};
+
+}
+
+#include "Lumen/Internal/Memory/FlatHashMap.inl"
\ No newline at end of file
@@ -0,0 +1,260 @@
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Constructor & Destructor
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline FlatHashMap<TKey, TValue, THash, TEqual>::FlatHashMap(size_t capacity)
+	{
+		Reserve(capacity);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline FlatHashMap<TKey, TValue, THash, TEqual>::~FlatHashMap()
+	{
+		Destroy();
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Copy/Move constructors
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline FlatHashMap<TKey, TValue, THash, TEqual>::FlatHashMap(FlatHashMap&& other) noexcept
+		: m_Control(std::exchange(other.m_Control, nullptr)), m_Slots(std::exchange(other.m_Slots, nullptr)), m_Capacity(std::exchange(other.m_Capacity, 0)), m_Size(std::exchange(other.m_Size, 0)), m_GrowthLeft(std::exchange(other.m_GrowthLeft, 0)), m_Hash(std::move(other.m_Hash)), m_Equal(std::move(other.m_Equal))
+	{
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline FlatHashMap<TKey, TValue, THash, TEqual>& FlatHashMap<TKey, TValue, THash, TEqual>::operator = (FlatHashMap&& other) noexcept
+	{
+		if (this == &other)
+			return *this;
+
+		Destroy();
+
+		m_Control = std::exchange(other.m_Control, nullptr);
+		m_Slots = std::exchange(other.m_Slots, nullptr);
+		m_Capacity = std::exchange(other.m_Capacity, 0);
+		m_Size = std::exchange(other.m_Size, 0);
+		m_GrowthLeft = std::exchange(other.m_GrowthLeft, 0);
+		m_Hash = std::move(other.m_Hash);
+		m_Equal = std::move(other.m_Equal);
+
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	template<typename ...Args>
+	hintinline std::pair<TValue*, bool> FlatHashMap<TKey, TValue, THash, TEqual>::Emplace(const TKey& key, Args&& ...args)
+	{
+		size_t hash = m_Hash(key);
+
+		if (m_Capacity != 0) [[likely]]
+		{
+			size_t index = FindIndex(key, hash);
+			if (index != m_Capacity)
+				return { &m_Slots[index].second, false };
+		}
+
+		if (m_GrowthLeft == 0) [[unlikely]]
+		{
+			// Note: Mostly tombstones means a rehash at the same capacity is enough to reclaim them
+			if ((m_Capacity != 0) && (m_Size < MaxLoad(m_Capacity) / 2))
+				Rehash(m_Capacity);
+			else
+				Rehash(std::max(m_Capacity * 2, MinCapacity));
+		}
+
+		size_t index = FindInsertIndex(hash);
+		new (&m_Slots[index]) Entry(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+
+		// Note: Reusing a tombstone doesn't use up growth, since tombstones were already counted
+		if (m_Control[index] == FlatHashMapGroup::Empty)
+			m_GrowthLeft--;
+
+		SetControl(index, H2(hash));
+		m_Size++;
+
+		return { &m_Slots[index].second, true };
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline TValue* FlatHashMap<TKey, TValue, THash, TEqual>::Find(const TKey& key)
+	{
+		if (m_Size == 0)
+			return nullptr;
+
+		size_t index = FindIndex(key, m_Hash(key));
+		return ((index != m_Capacity) ? &m_Slots[index].second : nullptr);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline const TValue* FlatHashMap<TKey, TValue, THash, TEqual>::Find(const TKey& key) const
+	{
+		if (m_Size == 0)
+			return nullptr;
+
+		size_t index = FindIndex(key, m_Hash(key));
+		return ((index != m_Capacity) ? &m_Slots[index].second : nullptr);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline bool FlatHashMap<TKey, TValue, THash, TEqual>::Erase(const TKey& key)
+	{
+		if (m_Size == 0)
+			return false;
+
+		size_t index = FindIndex(key, m_Hash(key));
+		if (index == m_Capacity)
+			return false;
+
+		m_Slots[index].~Entry();
+		SetControl(index, FlatHashMapGroup::Deleted);
+		m_Size--;
+
+		return true;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline void FlatHashMap<TKey, TValue, THash, TEqual>::Clear()
+	{
+		if (m_Capacity == 0)
+			return;
+
+		if constexpr (!std::is_trivially_destructible_v<Entry>)
+		{
+			for (Entry& entry : *this)
+				entry.~Entry();
+		}
+
+		std::fill_n(m_Control, m_Capacity + GroupWidth, FlatHashMapGroup::Empty);
+		m_Size = 0;
+		m_GrowthLeft = MaxLoad(m_Capacity);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline void FlatHashMap<TKey, TValue, THash, TEqual>::Reserve(size_t count)
+	{
+		size_t capacity = std::max(std::bit_ceil((count * MaxLoadDenominator + MaxLoadNumerator - 1) / MaxLoadNumerator), MinCapacity);
+		if (capacity > m_Capacity)
+			Rehash(capacity);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline size_t FlatHashMap<TKey, TValue, THash, TEqual>::FindIndex(const TKey& key, size_t hash) const
+	{
+		size_t mask = m_Capacity - 1;
+		size_t position = H1(hash) & mask;
+		int8_t control = H2(hash);
+
+		// Note: Triangular probing over groups, which visits every group since the capacity is a power of two
+		for (size_t probe = 1; ; probe++)
+		{
+			FlatHashMapGroup::Group group(m_Control + position);
+
+			for (uint32_t matches = group.Match(control); matches != 0; matches &= (matches - 1))
+			{
+				size_t index = (position + std::countr_zero(matches)) & mask;
+				if (m_Equal(m_Slots[index].first, key)) [[likely]]
+					return index;
+			}
+
+			if (group.MatchEmpty() != 0) [[likely]]
+				return m_Capacity;
+
+			position = (position + probe * GroupWidth) & mask;
+		}
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline size_t FlatHashMap<TKey, TValue, THash, TEqual>::FindInsertIndex(size_t hash) const
+	{
+		size_t mask = m_Capacity - 1;
+		size_t position = H1(hash) & mask;
+
+		for (size_t probe = 1; ; probe++)
+		{
+			uint32_t available = FlatHashMapGroup::Group(m_Control + position).MatchEmptyOrDeleted();
+			if (available != 0) [[likely]]
+				return (position + std::countr_zero(available)) & mask;
+
+			position = (position + probe * GroupWidth) & mask;
+		}
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline void FlatHashMap<TKey, TValue, THash, TEqual>::SetControl(size_t index, int8_t control)
+	{
+		m_Control[index] = control;
+
+		if (index < GroupWidth)
+			m_Control[m_Capacity + index] = control;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline void FlatHashMap<TKey, TValue, THash, TEqual>::Rehash(size_t capacity)
+	{
+		LU_ASSERT(std::has_single_bit(capacity) && (capacity >= MinCapacity), "[FlatHashMap] Capacity must be a power of two of at least the group width.");
+		LU_ASSERT((m_Size <= MaxLoad(capacity)), "[FlatHashMap] Capacity is too small for the current size.");
+
+		int8_t* oldControl = m_Control;
+		Entry* oldSlots = m_Slots;
+		size_t oldCapacity = m_Capacity;
+
+		std::byte* memory = static_cast<std::byte*>(::operator new(GetSlotOffset(capacity) + capacity * sizeof(Entry), std::align_val_t(SlotAlignment)));
+		m_Control = reinterpret_cast<int8_t*>(memory);
+		m_Slots = reinterpret_cast<Entry*>(memory + GetSlotOffset(capacity));
+		m_Capacity = capacity;
+		m_GrowthLeft = MaxLoad(capacity) - m_Size;
+
+		std::fill_n(m_Control, capacity + GroupWidth, FlatHashMapGroup::Empty);
+
+		for (size_t i = 0; i < oldCapacity; i++)
+		{
+			if (oldControl[i] < 0)
+				continue;
+
+			Entry& entry = oldSlots[i];
+			size_t hash = m_Hash(entry.first);
+			size_t index = FindInsertIndex(hash);
+
+			// Note: The key is const in the entry, but the old entry is destroyed right after
+			new (&m_Slots[index]) Entry(std::move(const_cast<TKey&>(entry.first)), std::move(entry.second));
+			entry.~Entry();
+
+			SetControl(index, H2(hash));
+		}
+
+		if (oldControl)
+			::operator delete(oldControl, std::align_val_t(SlotAlignment));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEqual>
+	hintinline void FlatHashMap<TKey, TValue, THash, TEqual>::Destroy()
+	{
+		if (!m_Control)
+			return;
+
+		if constexpr (!std::is_trivially_destructible_v<Entry>)
+		{
+			for (Entry& entry : *this)
+				entry.~Entry();
+		}
+
+		::operator delete(m_Control, std::align_val_t(SlotAlignment));
+
+		m_Control = nullptr;
+		m_Slots = nullptr;
+		m_Capacity = 0;
+		m_Size = 0;
+		m_GrowthLeft = 0;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Lumen/Core/Core.hpp"
+#include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Memory/Array.hpp"
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <tuple>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <type_traits>
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Handle<TTag>
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename TTag>
+	struct Handle // Note: 20 bits of index & 12 bits of generation, the tag only keeps different pools' handles apart
+	{
+	public:
+		inline constexpr static const uint32_t IndexBits = 20;
+		inline constexpr static const uint32_t GenerationBits = 32 - IndexBits;
+		inline constexpr static const uint32_t IndexMask = (1u << IndexBits) - 1;
+		inline constexpr static const uint32_t GenerationMask = (1u << GenerationBits) - 1;
+	public:
+		uint32_t Value = 0; // Note: 0 is the null handle, since generations start at 1
+
+	public:
+		// Constructor & Destructor
+		constexpr Handle() = default;
+		constexpr Handle(uint32_t index, uint32_t generation)
+			: Value(((generation & GenerationMask) << IndexBits) | (index & IndexMask)) {}
+		constexpr ~Handle() = default;
+
+		// Operators
+		constexpr bool operator == (const Handle& other) const = default;
+		constexpr explicit operator bool () const { return (Value != 0); }
+
+		// Getters
+		constexpr uint32_t GetIndex() const { return (Value & IndexMask); }
+		constexpr uint32_t GetGeneration() const { return (Value >> IndexBits); }
+	};
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// HandlePool<TTag, Ts...>
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename TTag, typename ...Ts>
+	class HandlePool // Note: Generational slots with every column stored contiguously (SoA), in pages that never move
+	{
+	public:
+		using HandleType = Handle<TTag>;
+
+		inline constexpr static const size_t PageSize = 256;
+		inline constexpr static const size_t MaxPages = (1ull << HandleType::IndexBits) / PageSize;
+		inline constexpr static const uint32_t NoSlot = std::numeric_limits<uint32_t>::max();     // Note: End of the free list
+		inline constexpr static const uint32_t InUse = std::numeric_limits<uint32_t>::max() - 1; // Note: Marks live slots, so the last free slot isn't mistaken for one
+	public:
+		// Constructor & Destructor
+		HandlePool() = default;
+		~HandlePool() = default;
+
+		// Copy/Move constructors
+		HandlePool(const HandlePool&) = delete;
+		HandlePool(HandlePool&&) = delete;
+		HandlePool& operator = (const HandlePool&) = delete;
+		HandlePool& operator = (HandlePool&&) = delete;
+
+		// Methods
+		HandleType Create(Ts ...values);
+		bool Destroy(HandleType handle); // Note: Returns false for stale handles, otherwise every copy of the handle becomes stale
+
+		bool IsValid(HandleType handle) const;
+
+		// Note: Create & Destroy may be called from any thread, but a slot must not be accessed while it's being destroyed
+		template<auto Column>
+		forceinline auto& Get(HandleType handle) { CheckValid(handle); return std::get<static_cast<size_t>(Column)>(GetPage(handle.GetIndex()).Columns)[handle.GetIndex() % PageSize]; }
+		template<auto Column>
+		forceinline const auto& Get(HandleType handle) const { CheckValid(handle); return std::get<static_cast<size_t>(Column)>(GetPage(handle.GetIndex()).Columns)[handle.GetIndex() % PageSize]; }
+
+		template<typename TFunc>
+		void ForEach(TFunc&& func); // Note: Calls func(HandleType, Ts&...) for every live slot, in index order
+
+		// Getters
+		forceinline size_t Size() const { return m_Size; }
+		forceinline size_t Capacity() const { return m_PageCount.load(std::memory_order_acquire) * PageSize; }
+
+	private:
+		struct Page
+		{
+		public:
+			std::tuple<std::array<Ts, PageSize>...> Columns = { };
+
+			std::array<uint16_t, PageSize> Generations = { };
+			std::array<uint32_t, PageSize> Next = { }; // Note: Free list link, InUse while the slot is in use
+		};
+
+	private:
+		// Private methods
+		forceinline Page& GetPage(uint32_t index) const { return *m_Pages[index / PageSize]; }
+
+		forceinline void CheckValid([[maybe_unused]] HandleType handle) const
+		{
+			#if defined(LU_CONFIG_DEBUG)
+			LU_ASSERT(IsValid(handle), "[HandlePool] Used a null or stale handle.");
+			#endif
+		}
+
+		template<size_t ...Indices>
+		void Assign(Page& page, uint32_t slot, std::index_sequence<Indices...>, Ts&& ...values);
+
+	private:
+		std::mutex m_ThreadSafety = {};
+
+		Array<std::unique_ptr<Page>, MaxPages> m_Pages = { };
+		std::atomic<uint32_t> m_PageCount = 0; // Note: Published after the page, so lookups don't need the lock
+
+		uint32_t m_FreeList = NoSlot;
+		uint32_t m_Size = 0;
+	};
+
+}
+
+#include "Lumen/Internal/Memory/HandlePool.inl"
\ No newline at end of file
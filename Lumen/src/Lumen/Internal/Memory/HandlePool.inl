@@ -0,0 +1,105 @@
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename TTag, typename ...Ts>
+	hintinline typename HandlePool<TTag, Ts...>::HandleType HandlePool<TTag, Ts...>::Create(Ts ...values)
+	{
+		std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+		uint32_t index = m_FreeList;
+		if (index == NoSlot) [[unlikely]]
+		{
+			uint32_t pageCount = m_PageCount.load(std::memory_order_relaxed);
+			LU_ASSERT((pageCount < MaxPages), "[HandlePool] Ran out of handles.");
+
+			// Note: A new page is linked into the free list from low to high, so iteration stays mostly in order
+			Page& page = *(m_Pages[pageCount] = std::make_unique<Page>());
+			for (uint32_t i = 0; i < PageSize; i++)
+			{
+				page.Generations[i] = 1;
+				page.Next[i] = ((i + 1 < PageSize) ? static_cast<uint32_t>(pageCount * PageSize + i + 1) : NoSlot);
+			}
+
+			index = static_cast<uint32_t>(pageCount * PageSize);
+			m_PageCount.store(pageCount + 1, std::memory_order_release);
+		}
+
+		Page& page = GetPage(index);
+		uint32_t slot = index % PageSize;
+
+		m_FreeList = page.Next[slot];
+		page.Next[slot] = InUse;
+		Assign(page, slot, std::index_sequence_for<Ts...>(), std::move(values)...);
+
+		m_Size++;
+		return HandleType(index, page.Generations[slot]);
+	}
+
+	template<typename TTag, typename ...Ts>
+	hintinline bool HandlePool<TTag, Ts...>::Destroy(HandleType handle)
+	{
+		std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+		if (!IsValid(handle))
+			return false;
+
+		uint32_t index = handle.GetIndex();
+		Page& page = GetPage(index);
+		uint32_t slot = index % PageSize;
+
+		// Note: Generation 0 is skipped, so a null handle never matches a slot
+		uint16_t generation = static_cast<uint16_t>((page.Generations[slot] + 1) & HandleType::GenerationMask);
+		page.Generations[slot] = ((generation == 0) ? 1 : generation);
+
+		Assign(page, slot, std::index_sequence_for<Ts...>(), Ts()...);
+
+		page.Next[slot] = m_FreeList;
+		m_FreeList = index;
+
+		m_Size--;
+		return true;
+	}
+
+	template<typename TTag, typename ...Ts>
+	hintinline bool HandlePool<TTag, Ts...>::IsValid(HandleType handle) const
+	{
+		uint32_t index = handle.GetIndex();
+		if (!handle || (index / PageSize >= m_PageCount.load(std::memory_order_acquire)))
+			return false;
+
+		const Page& page = GetPage(index);
+		return (page.Next[index % PageSize] == InUse) && (page.Generations[index % PageSize] == handle.GetGeneration());
+	}
+
+	template<typename TTag, typename ...Ts>
+	template<typename TFunc>
+	hintinline void HandlePool<TTag, Ts...>::ForEach(TFunc&& func)
+	{
+		uint32_t pageCount = m_PageCount.load(std::memory_order_acquire);
+		for (uint32_t p = 0; p < pageCount; p++)
+		{
+			Page& page = *m_Pages[p];
+			for (uint32_t slot = 0; slot < PageSize; slot++)
+			{
+				if (page.Next[slot] != InUse)
+					continue;
+
+				std::apply([&](auto& ...columns) { func(HandleType(static_cast<uint32_t>(p * PageSize + slot), page.Generations[slot]), columns[slot]...); }, page.Columns);
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename TTag, typename ...Ts>
+	template<size_t ...Indices>
+	hintinline void HandlePool<TTag, Ts...>::Assign(Page& page, uint32_t slot, std::index_sequence<Indices...>, Ts&& ...values)
+	{
+		((std::get<Indices>(page.Columns)[slot] = std::move(values)), ...);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Lumen/Core/Core.hpp"
+#include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Utils/Settings.hpp"
+
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+namespace Lumen::Internal
+{
+
+	template<typename Signature, size_t Capacity = 32>
+	class InplaceFunction;
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// InplaceFunction<R(Args...), Capacity>
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename R, typename ...Args, size_t Capacity>
+	class InplaceFunction<R(Args...), Capacity> // Note: A std::function that stores the callable in place and never allocates
+	{
+	public:
+		// Constructor & Destructor
+		InplaceFunction() = default;
+		forceinline InplaceFunction(std::nullptr_t) {}
+		template<typename F>
+		InplaceFunction(F&& func) requires (!std::same_as<std::remove_cvref_t<F>, InplaceFunction> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>);
+		~InplaceFunction();
+
+		// Copy/Move constructors
+		InplaceFunction(const InplaceFunction& other);
+		InplaceFunction(InplaceFunction&& other) noexcept;
+		InplaceFunction& operator = (const InplaceFunction& other);
+		InplaceFunction& operator = (InplaceFunction&& other) noexcept;
+
+		// Operators
+		forceinline R operator () (Args... args) const { CheckValid(); return m_Invoke(m_Storage, std::forward<Args>(args)...); }
+		forceinline explicit operator bool () const { return (m_Invoke != nullptr); }
+
+		// Methods
+		void Reset();
+
+	private:
+		enum class Operation : uint8_t { Copy = 0, Move, Destroy };
+
+		using InvokeFn = R(*)(std::byte* storage, Args&&... args);
+		using ManageFn = void(*)(Operation operation, std::byte* dst, std::byte* src);
+
+	private:
+		// Private methods
+		forceinline void CheckValid() const
+		{
+			#if defined(LU_CONFIG_DEBUG)
+			LU_ASSERT(m_Invoke, "[InplaceFunction] Called an empty function.");
+			#endif
+		}
+
+		void Assign(const InplaceFunction& other);
+		void Assign(InplaceFunction&& other);
+
+		template<typename F>
+		static R Invoke(std::byte* storage, Args&&... args);
+		template<typename F>
+		static void Manage(Operation operation, std::byte* dst, std::byte* src);
+
+	private:
+		alignas(std::max_align_t) mutable std::byte m_Storage[Capacity] = {};
+
+		InvokeFn m_Invoke = nullptr;
+		ManageFn m_Manage = nullptr;
+	};
+
+}
+
+#include "Lumen/Internal/Memory/InplaceFunction.inl"
\ No newline at end of file
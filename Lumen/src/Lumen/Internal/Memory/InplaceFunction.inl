@@ -0,0 +1,128 @@
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Constructor & Destructor
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename R, typename ...Args, size_t Capacity>
+	template<typename F>
+	hintinline InplaceFunction<R(Args...), Capacity>::InplaceFunction(F&& func) requires (!std::same_as<std::remove_cvref_t<F>, InplaceFunction> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+	{
+		using Callable = std::decay_t<F>;
+		static_assert((sizeof(Callable) <= Capacity), "[InplaceFunction] Callable doesn't fit in the inline storage, increase the capacity or capture less.");
+		static_assert((alignof(Callable) <= alignof(std::max_align_t)), "[InplaceFunction] Callable is over-aligned.");
+		static_assert(std::is_copy_constructible_v<Callable>, "[InplaceFunction] Callable must be copy constructible.");
+		static_assert(std::is_nothrow_move_constructible_v<Callable>, "[InplaceFunction] Callable must be nothrow move constructible.");
+
+		new (m_Storage) Callable(std::forward<F>(func));
+		m_Invoke = &Invoke<Callable>;
+		m_Manage = &Manage<Callable>;
+	}
+
+	template<typename R, typename ...Args, size_t Capacity>
+	hintinline InplaceFunction<R(Args...), Capacity>::~InplaceFunction()
+	{
+		Reset();
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Copy/Move constructors
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename R, typename ...Args, size_t Capacity>
+	hintinline InplaceFunction<R(Args...), Capacity>::InplaceFunction(const InplaceFunction& other)
+	{
+		Assign(other);
+	}
+
+	template<typename R, typename ...Args, size_t Capacity>
+	hintinline InplaceFunction<R(Args...), Capacity>::InplaceFunction(InplaceFunction&& other) noexcept
+	{
+		Assign(std::move(other));
+	}
+
+	template<typename R, typename ...Args, size_t Capacity>
+	hintinline InplaceFunction<R(Args...), Capacity>& InplaceFunction<R(Args...), Capacity>::operator = (const InplaceFunction& other)
+	{
+		if (this != &other)
+		{
+			Reset();
+			Assign(other);
+		}
+		return *this;
+	}
+
+	template<typename R, typename ...Args, size_t Capacity>
+	hintinline InplaceFunction<R(Args...), Capacity>& InplaceFunction<R(Args...), Capacity>::operator = (InplaceFunction&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Reset();
+			Assign(std::move(other));
+		}
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename R, typename ...Args, size_t Capacity>
+	hintinline void InplaceFunction<R(Args...), Capacity>::Reset()
+	{
+		if (m_Manage)
+			m_Manage(Operation::Destroy, m_Storage, nullptr);
+
+		m_Invoke = nullptr;
+		m_Manage = nullptr;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename R, typename ...Args, size_t Capacity>
+	hintinline void InplaceFunction<R(Args...), Capacity>::Assign(const InplaceFunction& other)
+	{
+		if (other.m_Manage)
+			other.m_Manage(Operation::Copy, m_Storage, other.m_Storage);
+
+		m_Invoke = other.m_Invoke;
+		m_Manage = other.m_Manage;
+	}
+
+	template<typename R, typename ...Args, size_t Capacity>
+	hintinline void InplaceFunction<R(Args...), Capacity>::Assign(InplaceFunction&& other)
+	{
+		if (other.m_Manage)
+			other.m_Manage(Operation::Move, m_Storage, other.m_Storage);
+
+		m_Invoke = other.m_Invoke;
+		m_Manage = other.m_Manage;
+
+		other.Reset();
+	}
+
+	template<typename R, typename ...Args, size_t Capacity>
+	template<typename F>
+	hintinline R InplaceFunction<R(Args...), Capacity>::Invoke(std::byte* storage, Args&&... args)
+	{
+		return static_cast<R>(std::invoke(*std::launder(reinterpret_cast<F*>(storage)), std::forward<Args>(args)...));
+	}
+
+	template<typename R, typename ...Args, size_t Capacity>
+	template<typename F>
+	hintinline void InplaceFunction<R(Args...), Capacity>::Manage(Operation operation, std::byte* dst, std::byte* src)
+	{
+		switch (operation)
+		{
+		case Operation::Copy:
+			new (dst) F(*std::launder(reinterpret_cast<const F*>(src)));
+			break;
+		case Operation::Move:
+			new (dst) F(std::move(*std::launder(reinterpret_cast<F*>(src))));
+			break;
+		case Operation::Destroy:
+			std::launder(reinterpret_cast<F*>(dst))->~F();
+			break;
+		}
+	}
+
+}
\ No newline at end of file
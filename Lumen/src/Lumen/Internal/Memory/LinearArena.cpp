@@ -0,0 +1,104 @@
+#include "lupch.h"
+#include "LinearArena.hpp"
+
+#include "Lumen/Internal/IO/Print.hpp"
+
+#include <new>
+#include <bit>
+#include <algorithm>
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Constructor & Destructor
+	////////////////////////////////////////////////////////////////////////////////////
+	LinearArena::LinearArena(size_t chunkSize)
+		: m_ChunkSize(chunkSize)
+	{
+	}
+
+	LinearArena::~LinearArena()
+	{
+		FreeChunks();
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void LinearArena::Reset()
+	{
+		// Note: The next frame will most likely need the same amount, so a single chunk of the combined size replaces multiple chunks
+		if (m_ChunkCount > 1)
+		{
+			size_t capacity = m_Capacity;
+
+			FreeChunks();
+			AllocateChunk(capacity);
+		}
+
+		if (m_Chunk)
+		{
+			m_Current = reinterpret_cast<std::byte*>(m_Chunk + 1);
+			m_End = m_Current + m_Chunk->Size;
+		}
+
+		m_Used = 0;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// std::pmr::memory_resource
+	////////////////////////////////////////////////////////////////////////////////////
+	void* LinearArena::do_allocate(size_t bytes, size_t alignment)
+	{
+		LU_ASSERT(std::has_single_bit(alignment), "[LinearArena] Alignment must be a power of two.");
+
+		uintptr_t address = (reinterpret_cast<uintptr_t>(m_Current) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+		if (!m_Current || (address + bytes > reinterpret_cast<uintptr_t>(m_End))) [[unlikely]]
+		{
+			// Note: Chunks grow geometrically, so a frame that outgrows the arena only adds a few chunks
+			AllocateChunk(std::max({ bytes + alignment, m_ChunkSize, m_Chunk ? m_Chunk->Size * 2 : 0 }));
+			address = (reinterpret_cast<uintptr_t>(m_Current) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+		}
+
+		std::byte* memory = reinterpret_cast<std::byte*>(address);
+		m_Used += static_cast<size_t>((memory + bytes) - m_Current);
+		m_Current = memory + bytes;
+
+		return memory;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void LinearArena::AllocateChunk(size_t size)
+	{
+		Chunk* chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + size, std::align_val_t(alignof(std::max_align_t))));
+		chunk->Previous = m_Chunk;
+		chunk->Size = size;
+
+		m_Chunk = chunk;
+		m_Current = reinterpret_cast<std::byte*>(chunk + 1);
+		m_End = m_Current + size;
+
+		m_Capacity += size;
+		m_ChunkCount++;
+		m_ChunkAllocations++;
+	}
+
+	void LinearArena::FreeChunks()
+	{
+		while (m_Chunk)
+		{
+			Chunk* previous = m_Chunk->Previous;
+			::operator delete(m_Chunk, std::align_val_t(alignof(std::max_align_t)));
+			m_Chunk = previous;
+		}
+
+		m_Current = nullptr;
+		m_End = nullptr;
+		m_Capacity = 0;
+		m_ChunkCount = 0;
+	}
+
+}
\ No newline at end of file
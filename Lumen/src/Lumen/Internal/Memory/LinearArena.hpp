@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Lumen/Core/Core.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// LinearArena
+	////////////////////////////////////////////////////////////////////////////////////
+	class LinearArena : public std::pmr::memory_resource // Note: Bump allocator, deallocation is a no-op and everything is freed at once by Reset. Not thread safe.
+	{
+	public:
+		// Settings
+		inline constexpr static const size_t DefaultChunkSize = 64 * 1024;
+	public:
+		// Constructor & Destructor
+		LinearArena(size_t chunkSize = DefaultChunkSize); // Note: The first chunk is allocated on first use
+		~LinearArena();
+
+		// Copy/Move constructors
+		LinearArena(const LinearArena&) = delete;
+		LinearArena(LinearArena&&) = delete;
+		LinearArena& operator = (const LinearArena&) = delete;
+		LinearArena& operator = (LinearArena&&) = delete;
+
+		// Methods
+		void Reset(); // Note: Invalidates all allocations, chunks are merged into one so a repeat of the same usage doesn't allocate
+
+		// Getters
+		forceinline size_t GetUsed() const { return m_Used; }
+		forceinline size_t GetCapacity() const { return m_Capacity; }
+		forceinline size_t GetChunkCount() const { return m_ChunkCount; }
+		forceinline uint64_t GetChunkAllocations() const { return m_ChunkAllocations; } // Note: Total heap allocations made by the arena, stays constant once usage is steady
+
+	protected:
+		// std::pmr::memory_resource
+		void* do_allocate(size_t bytes, size_t alignment) override;
+		void do_deallocate(void*, size_t, size_t) override {}
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return (this == &other); }
+
+	private:
+		struct Chunk
+		{
+		public:
+			Chunk* Previous = nullptr;
+			size_t Size = 0; // Note: Usable bytes after the header
+		};
+
+	private:
+		// Private methods
+		void AllocateChunk(size_t size);
+		void FreeChunks();
+
+	private:
+		Chunk* m_Chunk = nullptr; // Note: The current chunk, older ones are linked through Previous
+		std::byte* m_Current = nullptr;
+		std::byte* m_End = nullptr;
+
+		size_t m_ChunkSize;
+		size_t m_Used = 0;     // Note: Bytes handed out since the last Reset, including alignment padding
+		size_t m_Capacity = 0; // Note: Usable bytes over all chunks
+		size_t m_ChunkCount = 0;
+		uint64_t m_ChunkAllocations = 0;
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Lumen/Core/Core.hpp"
+#include "Lumen/Internal/Utils/Settings.hpp"
+
+#include <bit>
+#include <new>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// SPSCQueue<T, Capacity>
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename T, size_t Capacity>
+	class SPSCQueue // Note: Lock-free single producer single consumer ring, Push may only be called from one thread & Pop from one (other) thread
+	{
+	public:
+		static_assert(std::has_single_bit(Capacity), "[SPSCQueue] Capacity must be a power of two.");
+		static_assert(std::is_nothrow_move_constructible_v<T>, "[SPSCQueue] T must be nothrow move constructible.");
+
+		inline constexpr static const size_t CacheLineSize = 64; // Note: Keeps the producer & consumer indices from false sharing
+	public:
+		// Constructor & Destructor
+		SPSCQueue() = default;
+		~SPSCQueue();
+
+		// Copy/Move constructors
+		SPSCQueue(const SPSCQueue&) = delete;
+		SPSCQueue(SPSCQueue&&) = delete;
+		SPSCQueue& operator = (const SPSCQueue&) = delete;
+		SPSCQueue& operator = (SPSCQueue&&) = delete;
+
+		// Methods
+		template<typename ...Args>
+		bool Push(Args&& ...args); // Note: Returns false if the queue is full
+		std::optional<T> Pop();    // Note: Returns std::nullopt if the queue is empty
+
+		// Getters
+		forceinline bool Empty() const { return (m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire)); }
+		forceinline size_t Size() const { return (m_Tail.load(std::memory_order_acquire) - m_Head.load(std::memory_order_acquire)); } // Note: Only an estimate while the other side is active
+
+	private:
+		forceinline T* GetSlot(size_t index) { return std::launder(reinterpret_cast<T*>(m_Storage + (index & (Capacity - 1)) * sizeof(T))); }
+
+	private:
+		alignas(CacheLineSize) std::atomic<size_t> m_Tail = 0; // Note: Written by the producer
+		size_t m_CachedHead = 0;                               // Note: Producer's view of the head
+
+		alignas(CacheLineSize) std::atomic<size_t> m_Head = 0; // Note: Written by the consumer
+		size_t m_CachedTail = 0;                               // Note: Consumer's view of the tail
+
+		alignas(CacheLineSize) alignas(T) std::byte m_Storage[Capacity * sizeof(T)] = {};
+	};
+
+}
+
+#include "Lumen/Internal/Memory/SPSCQueue.inl"
\ No newline at end of file
@@ -0,0 +1,60 @@
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Constructor & Destructor
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename T, size_t Capacity>
+	hintinline SPSCQueue<T, Capacity>::~SPSCQueue()
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			size_t tail = m_Tail.load(std::memory_order_acquire);
+			for (size_t i = m_Head.load(std::memory_order_acquire); i != tail; i++)
+				GetSlot(i)->~T();
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename T, size_t Capacity>
+	template<typename ...Args>
+	hintinline bool SPSCQueue<T, Capacity>::Push(Args&& ...args)
+	{
+		size_t tail = m_Tail.load(std::memory_order_relaxed);
+
+		// Note: Only reload the head (shared cache line) when our cached view says we're full
+		if (tail - m_CachedHead == Capacity) [[unlikely]]
+		{
+			m_CachedHead = m_Head.load(std::memory_order_acquire);
+			if (tail - m_CachedHead == Capacity)
+				return false;
+		}
+
+		new (m_Storage + (tail & (Capacity - 1)) * sizeof(T)) T(std::forward<Args>(args)...);
+		m_Tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	template<typename T, size_t Capacity>
+	hintinline std::optional<T> SPSCQueue<T, Capacity>::Pop()
+	{
+		size_t head = m_Head.load(std::memory_order_relaxed);
+
+		if (head == m_CachedTail)
+		{
+			m_CachedTail = m_Tail.load(std::memory_order_acquire);
+			if (head == m_CachedTail)
+				return std::nullopt;
+		}
+
+		T* slot = GetSlot(head);
+		std::optional<T> value = std::move(*slot);
+		slot->~T();
+
+		m_Head.store(head + 1, std::memory_order_release);
+		return value;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Lumen/Core/Core.hpp"
+#include "Lumen/Internal/IO/Print.hpp"
+
+#include <new>
+#include <span>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <memory_resource>
+#include <initializer_list>
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// SmallVector<T, N>
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename T, size_t N>
+	class SmallVector // Note: Stores up to N elements inline, only grows into the memory resource past that
+	{
+	public:
+		static_assert((N > 0), "[SmallVector] Inline capacity must be at least 1.");
+
+		using value_type = T;
+		using allocator_type = std::pmr::polymorphic_allocator<T>; // Note: So containers like std::pmr::vector pass their resource down
+
+		using Iterator = T*;
+		using ConstIterator = const T*;
+
+		inline constexpr static const size_t InlineCapacity = N;
+	public:
+		// Constructor & Destructor
+		forceinline SmallVector(const allocator_type& allocator = { })
+			: m_Resource(allocator.resource()) {}
+		explicit SmallVector(size_t count, const allocator_type& allocator = { }); // Note: Value initializes
+		SmallVector(std::initializer_list<T> values, const allocator_type& allocator = { });
+		SmallVector(std::span<const T> values, const allocator_type& allocator = { });
+		template<std::input_iterator It>
+		SmallVector(It first, It last, const allocator_type& allocator = { });
+		~SmallVector();
+
+		// Copy/Move constructors
+		forceinline SmallVector(const SmallVector& other) // Note: Like std::pmr containers, copies don't inherit the resource
+			: SmallVector(std::span<const T>(other.Data(), other.Size())) {}
+		forceinline SmallVector(const SmallVector& other, const allocator_type& allocator)
+			: SmallVector(std::span<const T>(other.Data(), other.Size()), allocator) {}
+		forceinline SmallVector(SmallVector&& other) noexcept
+			: SmallVector(std::move(other), allocator_type(other.m_Resource)) {}
+		SmallVector(SmallVector&& other, const allocator_type& allocator);
+		SmallVector& operator = (const SmallVector& other);
+		SmallVector& operator = (SmallVector&& other);
+
+		// Operators
+		forceinline T& operator [] (size_t index) { CheckIndex(index); return m_Data[index]; }
+		forceinline const T& operator [] (size_t index) const { CheckIndex(index); return m_Data[index]; }
+
+		// Methods
+		template<typename ...Args>
+		T& Emplace(Args&& ...args); // Note: Appends, args may reference an element of this vector
+		forceinline void Push(const T& value) { Emplace(value); }
+		forceinline void Push(T&& value) { Emplace(std::move(value)); }
+		void Pop();
+
+		void Resize(size_t count); // Note: New elements are value initialized
+		void Reserve(size_t capacity);
+		void Clear(); // Note: Keeps the capacity
+
+		template<std::input_iterator It>
+		void Assign(It first, It last);
+
+		// Iterators
+		forceinline Iterator begin() { return m_Data; }
+		forceinline Iterator end() { return m_Data + m_Size; }
+		forceinline ConstIterator begin() const { return m_Data; }
+		forceinline ConstIterator end() const { return m_Data + m_Size; }
+
+		// Getters
+		forceinline T* Data() { return m_Data; }
+		forceinline const T* Data() const { return m_Data; }
+		forceinline T& Front() { CheckIndex(0); return m_Data[0]; }
+		forceinline T& Back() { CheckIndex(0); return m_Data[m_Size - 1]; }
+
+		forceinline size_t Size() const { return m_Size; }
+		forceinline size_t Capacity() const { return m_Capacity; }
+		forceinline bool Empty() const { return (m_Size == 0); }
+		forceinline bool IsInline() const { return (m_Data == GetInline()); }
+
+		forceinline allocator_type get_allocator() const { return allocator_type(m_Resource); }
+
+	private:
+		// Private methods
+		forceinline T* GetInline() { return std::launder(reinterpret_cast<T*>(m_Inline)); }
+		forceinline const T* GetInline() const { return std::launder(reinterpret_cast<const T*>(m_Inline)); }
+
+		forceinline void CheckIndex(size_t index) const
+		{
+			#if defined(LU_CONFIG_DEBUG)
+			LU_ASSERT((index < m_Size), "[SmallVector] Index out of range.");
+			#else
+			(void)index;
+			#endif
+		}
+
+		T* Allocate(size_t capacity);
+		void Release();                    // Note: Frees the heap buffer, elements must be destroyed already
+		void Relocate(T* data, size_t capacity); // Note: Moves all elements into data & takes ownership of it
+		forceinline size_t GrowCapacity(size_t minimum) const { return std::max(m_Capacity * 2, minimum); }
+
+	private:
+		T* m_Data = GetInline();
+		size_t m_Size = 0;
+		size_t m_Capacity = N;
+
+		std::pmr::memory_resource* m_Resource; // Note: Only used once the inline storage is exceeded
+
+		alignas(T) std::byte m_Inline[N * sizeof(T)];
+	};
+
+}
+
+#include "Lumen/Internal/Memory/SmallVector.inl"
\ No newline at end of file
@@ -0,0 +1,206 @@
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Constructor & Destructor
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename T, size_t N>
+	hintinline SmallVector<T, N>::SmallVector(size_t count, const allocator_type& allocator)
+		: m_Resource(allocator.resource())
+	{
+		Resize(count);
+	}
+
+	template<typename T, size_t N>
+	hintinline SmallVector<T, N>::SmallVector(std::initializer_list<T> values, const allocator_type& allocator)
+		: m_Resource(allocator.resource())
+	{
+		Assign(values.begin(), values.end());
+	}
+
+	template<typename T, size_t N>
+	hintinline SmallVector<T, N>::SmallVector(std::span<const T> values, const allocator_type& allocator)
+		: m_Resource(allocator.resource())
+	{
+		Assign(values.begin(), values.end());
+	}
+
+	template<typename T, size_t N>
+	template<std::input_iterator It>
+	hintinline SmallVector<T, N>::SmallVector(It first, It last, const allocator_type& allocator)
+		: m_Resource(allocator.resource())
+	{
+		Assign(first, last);
+	}
+
+	template<typename T, size_t N>
+	hintinline SmallVector<T, N>::~SmallVector()
+	{
+		Clear();
+		Release();
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Copy/Move constructors
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename T, size_t N>
+	hintinline SmallVector<T, N>::SmallVector(SmallVector&& other, const allocator_type& allocator)
+		: m_Resource(allocator.resource())
+	{
+		// Note: A heap buffer can only be stolen if it would be freed to the same resource
+		if (!other.IsInline() && m_Resource->is_equal(*other.m_Resource))
+		{
+			m_Data = std::exchange(other.m_Data, other.GetInline());
+			m_Size = std::exchange(other.m_Size, 0);
+			m_Capacity = std::exchange(other.m_Capacity, N);
+			return;
+		}
+
+		Assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+		other.Clear();
+	}
+
+	template<typename T, size_t N>
+	hintinline SmallVector<T, N>& SmallVector<T, N>::operator = (const SmallVector& other)
+	{
+		if (this == &other)
+			return *this;
+
+		Assign(other.begin(), other.end());
+		return *this;
+	}
+
+	template<typename T, size_t N>
+	hintinline SmallVector<T, N>& SmallVector<T, N>::operator = (SmallVector&& other)
+	{
+		if (this == &other)
+			return *this;
+
+		if (!other.IsInline() && m_Resource->is_equal(*other.m_Resource))
+		{
+			Clear();
+			Release();
+
+			m_Data = std::exchange(other.m_Data, other.GetInline());
+			m_Size = std::exchange(other.m_Size, 0);
+			m_Capacity = std::exchange(other.m_Capacity, N);
+			return *this;
+		}
+
+		Assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+		other.Clear();
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename T, size_t N>
+	template<typename ...Args>
+	hintinline T& SmallVector<T, N>::Emplace(Args&& ...args)
+	{
+		if (m_Size < m_Capacity) [[likely]]
+			return *std::construct_at(m_Data + m_Size++, std::forward<Args>(args)...);
+
+		// Note: The new element is constructed before the old ones move, since args may point into them
+		size_t capacity = GrowCapacity(m_Size + 1);
+		T* data = Allocate(capacity);
+		std::construct_at(data + m_Size, std::forward<Args>(args)...);
+
+		Relocate(data, capacity);
+		return m_Data[m_Size++];
+	}
+
+	template<typename T, size_t N>
+	hintinline void SmallVector<T, N>::Pop()
+	{
+		CheckIndex(0);
+		std::destroy_at(m_Data + --m_Size);
+	}
+
+	template<typename T, size_t N>
+	hintinline void SmallVector<T, N>::Resize(size_t count)
+	{
+		if (count < m_Size)
+		{
+			std::destroy(m_Data + count, m_Data + m_Size);
+			m_Size = count;
+			return;
+		}
+
+		Reserve(count);
+		for (; m_Size < count; m_Size++)
+			std::construct_at(m_Data + m_Size);
+	}
+
+	template<typename T, size_t N>
+	hintinline void SmallVector<T, N>::Reserve(size_t capacity)
+	{
+		if (capacity <= m_Capacity)
+			return;
+
+		Relocate(Allocate(capacity), capacity);
+	}
+
+	template<typename T, size_t N>
+	hintinline void SmallVector<T, N>::Clear()
+	{
+		std::destroy(m_Data, m_Data + m_Size);
+		m_Size = 0;
+	}
+
+	template<typename T, size_t N>
+	template<std::input_iterator It>
+	hintinline void SmallVector<T, N>::Assign(It first, It last)
+	{
+		Clear();
+
+		if constexpr (std::forward_iterator<It>)
+			Reserve(static_cast<size_t>(std::distance(first, last)));
+
+		for (; first != last; ++first)
+			Emplace(*first);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename T, size_t N>
+	hintinline T* SmallVector<T, N>::Allocate(size_t capacity)
+	{
+		return static_cast<T*>(m_Resource->allocate(capacity * sizeof(T), alignof(T)));
+	}
+
+	template<typename T, size_t N>
+	hintinline void SmallVector<T, N>::Release()
+	{
+		if (!IsInline())
+			m_Resource->deallocate(m_Data, m_Capacity * sizeof(T), alignof(T));
+
+		m_Data = GetInline();
+		m_Capacity = N;
+	}
+
+	template<typename T, size_t N>
+	hintinline void SmallVector<T, N>::Relocate(T* data, size_t capacity)
+	{
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (m_Size != 0)
+				std::memcpy(static_cast<void*>(data), m_Data, m_Size * sizeof(T));
+		}
+		else
+		{
+			std::uninitialized_move(m_Data, m_Data + m_Size, data);
+			std::destroy(m_Data, m_Data + m_Size);
+		}
+
+		size_t size = m_Size;
+		Release();
+
+		m_Data = data;
+		m_Size = size;
+		m_Capacity = capacity;
+	}
+
+}
\ No newline at end of file
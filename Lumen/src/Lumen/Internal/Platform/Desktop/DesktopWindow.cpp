@@ -24,7 +24,7 @@ namespace Lumen::Internal
     // Constructors & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
     DesktopWindow::DesktopWindow(const WindowSpecification& specs, Window* instance)
-		: m_Specification(specs)
+		: m_Specification(specs), m_Size((static_cast<uint64_t>(specs.Width) << 32) | specs.Height)
     {
         LU_ASSERT(!specs.Title.empty(), "[DesktopWindow] No title passed in.");
         LU_ASSERT(((specs.Width != 0) && (specs.Height != 0)), "[DesktopWindow] Invalid width & height passed in.");
@@ -42,6 +42,7 @@ namespace Lumen::Internal
 
         // Create the window
         glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+        glfwWindowHint(GLFW_VISIBLE, (specs.Visible ? GLFW_TRUE : GLFW_FALSE));
         m_Window = glfwCreateWindow(static_cast<int>(specs.Width), static_cast<int>(specs.Height), specs.Title.data(), nullptr, nullptr);
         LU_ASSERT(m_Window, "[DesktopWindow] Failed to create a window.");
 
@@ -51,93 +52,94 @@ namespace Lumen::Internal
             GraphicsContext::Init();
 
         // Making sure we can access the data in the callbacks
-        glfwSetWindowUserPointer(m_Window, (void*)&m_Specification);
+        glfwSetWindowUserPointer(m_Window, static_cast<void*>(this));
 
         // Setting the callbacks
         glfwSetWindowSizeCallback(m_Window, [](GLFWwindow* window, int width, int height)
             {
-                WindowSpecification& data = *(WindowSpecification*)glfwGetWindowUserPointer(window);
-                data.Width = width;
-                data.Height = height;
+                DesktopWindow& data = *static_cast<DesktopWindow*>(glfwGetWindowUserPointer(window));
+
+                // Note: Applied while polling, so the size is only ever written from the main thread, even with ThreadedInput
+                data.SetSize(static_cast<uint32_t>(width), static_cast<uint32_t>(height));
 
                 WindowResizeEvent event = WindowResizeEvent(width, height);
-                data.EventCallback(event);
+                data.QueueEvent(event);
             });
         glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* window)
             {
-                WindowSpecification& data = *(WindowSpecification*)glfwGetWindowUserPointer(window);
+                DesktopWindow& data = *static_cast<DesktopWindow*>(glfwGetWindowUserPointer(window));
 
                 WindowCloseEvent event = WindowCloseEvent();
-                data.EventCallback(event);
+                data.QueueEvent(event);
             });
 
         glfwSetKeyCallback(m_Window, [](GLFWwindow* window, int key, int, int action, int)
             {
-                WindowSpecification& data = *(WindowSpecification*)glfwGetWindowUserPointer(window);
+                DesktopWindow& data = *static_cast<DesktopWindow*>(glfwGetWindowUserPointer(window));
 
                 switch (action)
                 {
                 case GLFW_PRESS:
                 {
                     KeyPressedEvent event = KeyPressedEvent(key, 0);
-                    data.EventCallback(event);
+                    data.QueueEvent(event);
                     break;
                 }
                 case GLFW_RELEASE:
                 {
                     KeyReleasedEvent event = KeyReleasedEvent(key);
-                    data.EventCallback(event);
+                    data.QueueEvent(event);
                     break;
                 }
                 case GLFW_REPEAT:
                 {
                     KeyPressedEvent event = KeyPressedEvent(key, 1);
-                    data.EventCallback(event);
+                    data.QueueEvent(event);
                     break;
                 }
                 }
             });
         glfwSetCharCallback(m_Window, [](GLFWwindow* window, unsigned int keycode)
             {
-                WindowSpecification& data = *(WindowSpecification*)glfwGetWindowUserPointer(window);
+                DesktopWindow& data = *static_cast<DesktopWindow*>(glfwGetWindowUserPointer(window));
 
                 KeyTypedEvent event = KeyTypedEvent(keycode);
-                data.EventCallback(event);
+                data.QueueEvent(event);
             });
 
         glfwSetMouseButtonCallback(m_Window, [](GLFWwindow* window, int button, int action, int)
             {
-                WindowSpecification& data = *(WindowSpecification*)glfwGetWindowUserPointer(window);
+                DesktopWindow& data = *static_cast<DesktopWindow*>(glfwGetWindowUserPointer(window));
 
                 switch (action) 
                 {
                 case GLFW_PRESS: 
                 {
                     MouseButtonPressedEvent event = MouseButtonPressedEvent(button);
-                    data.EventCallback(event);
+                    data.QueueEvent(event);
                     break;
                 }
                 case GLFW_RELEASE: 
                 {
                     MouseButtonReleasedEvent event = MouseButtonReleasedEvent(button);
-                    data.EventCallback(event);
+                    data.QueueEvent(event);
                     break;
                 }
                 }
             });
         glfwSetScrollCallback(m_Window, [](GLFWwindow* window, double xOffset, double yOffset)
             {
-                WindowSpecification& data = *(WindowSpecification*)glfwGetWindowUserPointer(window);
+                DesktopWindow& data = *static_cast<DesktopWindow*>(glfwGetWindowUserPointer(window));
 
                 MouseScrolledEvent event = MouseScrolledEvent((float)xOffset, (float)yOffset);
-                data.EventCallback(event);
+                data.QueueEvent(event);
             });
         glfwSetCursorPosCallback(m_Window, [](GLFWwindow* window, double xPos, double yPos)
             {
-                WindowSpecification& data = *(WindowSpecification*)glfwGetWindowUserPointer(window);
+                DesktopWindow& data = *static_cast<DesktopWindow*>(glfwGetWindowUserPointer(window));
 
                 MouseMovedEvent event = MouseMovedEvent((float)xPos, (float)yPos);
-                data.EventCallback(event);
+                data.QueueEvent(event);
             });
 
         m_Renderer.Construct(RendererSpecification({
@@ -171,6 +173,79 @@ namespace Lumen::Internal
             glfwTerminate();
         }
     }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void DesktopWindow::DispatchEvents()
+    {
+        LU_PROFILE("DesktopWindow::DispatchEvents()");
+        LU_MEM_TAG(Events);
+
+        if (m_Specification.ThreadedInput)
+        {
+            #if defined(LU_CONFIG_DEBUG)
+            std::thread::id expected = {};
+            if (!m_DispatchThread.compare_exchange_strong(expected, std::this_thread::get_id()))
+                LU_ASSERT((expected == std::this_thread::get_id()), "[DesktopWindow] With ThreadedInput, DispatchEvents must always be called from the same thread.");
+            #endif
+
+            while (std::optional<Event> e = m_EventQueue.Pop())
+                m_Specification.EventCallback(*e);
+            return;
+        }
+
+        // Note: Swapped out so the callback can safely cause new events to be queued
+        std::swap(m_Events, m_DispatchedEvents);
+
+        for (Event& e : m_DispatchedEvents)
+            m_Specification.EventCallback(e);
+
+        m_DispatchedEvents.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void DesktopWindow::QueueEvent(Event e)
+    {
+        LU_MEM_TAG(Events);
+
+        std::visit([](EventBase& base) { base.SetTimestamp(EventBase::Now()); }, e);
+
+        // Note: Consecutive mouse moves & resizes only keep the latest, so a drag-resize results in one resize per poll
+        if (!m_Events.empty() && (m_Events.back().index() == e.index()))
+        {
+            if (std::holds_alternative<MouseMovedEvent>(e) || std::holds_alternative<WindowResizeEvent>(e))
+            {
+                m_Events.back() = e;
+                return;
+            }
+        }
+
+        m_Events.push_back(e);
+    }
+
+    void DesktopWindow::FlushEvents()
+    {
+        LU_PROFILE("DesktopWindow::FlushEvents()");
+        LU_MEM_TAG(Events);
+
+        // Note: Events that don't fit stay queued (in order) for the next flush, so closes & resizes are never dropped
+        size_t pushed = 0;
+        while ((pushed < m_Events.size()) && m_EventQueue.Push(m_Events[pushed]))
+            pushed++;
+
+        m_Events.erase(m_Events.begin(), m_Events.begin() + static_cast<ptrdiff_t>(pushed));
+    }
+
+    void DesktopWindow::SetSize(uint32_t width, uint32_t height)
+    {
+        m_Specification.Width = width;
+        m_Specification.Height = height;
+
+        m_Size.store((static_cast<uint64_t>(width) << 32) | height, std::memory_order_release);
+    }
 #endif
 
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Lumen/Internal/Utils/Profiler.hpp"
 #include "Lumen/Internal/Utils/Preprocessor.hpp"
 
+#include "Lumen/Internal/Memory/SPSCQueue.hpp"
 #include "Lumen/Internal/Memory/DeferredConstruct.hpp"
 
 #include "Lumen/Internal/Core/WindowSpec.hpp"
@@ -12,6 +13,10 @@
 
 #include "Lumen/Maths/Structs.hpp"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #if defined(LU_PLATFORM_DESKTOP)
 	#include <GLFW/glfw3.h>
 #endif
@@ -28,20 +33,24 @@ namespace Lumen::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	class DesktopWindow
 	{
+	public:
+		// Settings
+		inline constexpr static const size_t EventQueueSize = 1024; // Note: Only used with ThreadedInput
 	public:
 		// Constructors & Destructor
 		DesktopWindow(const WindowSpecification& specs, Window* instance);
 		~DesktopWindow();
 
 		// Methods
-		void PollEvents();
+		void PollEvents(); // Note: Must be called from the main thread
+		void DispatchEvents(); // Note: Called by PollEvents, unless ThreadedInput is enabled
 		void SwapBuffers();
 
 		void Resize(uint32_t width, uint32_t height);
 		inline void Close() { m_Closed = true; }
 
 		// Getters
-		inline Vec2<uint32_t> GetSize() const { return { m_Specification.Width, m_Specification.Height }; }
+		Vec2<uint32_t> GetSize() const; // Note: Safe to call from the dispatching thread
 		Vec2<int32_t> GetPosition() const;
 
 		// Setters
@@ -52,18 +61,34 @@ namespace Lumen::Internal
 		double GetTime() const;
 		inline bool IsVSync() const { return m_Specification.VSync; }
 		inline bool IsOpen() const { return !m_Closed; }
-		inline bool IsMinimized() const { return ((m_Specification.Width == 0) || (m_Specification.Height == 0)); }
+		inline bool IsMinimized() const { Vec2<uint32_t> size = GetSize(); return ((size.x == 0) || (size.y == 0)); }
 
 		inline void* GetNativeWindow() { return static_cast<void*>(m_Window); }
 		inline WindowSpecification& GetSpecification() { return m_Specification; }
 		inline Renderer& GetRenderer() { return m_Renderer.Get(); }
 
+	private:
+		// Private methods
+		void QueueEvent(Event e);
+		void FlushEvents();
+
+		void SetSize(uint32_t width, uint32_t height); // Note: Must be called from the main thread
+
 	private:
 		WindowSpecification m_Specification;
 		
 		GLFWwindow* m_Window = nullptr;
 		
-		bool m_Closed = false;
+		std::atomic<bool> m_Closed = false;
+		std::atomic<uint64_t> m_Size = 0; // Note: Width & height packed, published for the dispatching thread
+
+		// Note: Events are queued during PollEvents and dispatched in one batch afterwards
+		std::vector<Event> m_Events = { };
+		std::vector<Event> m_DispatchedEvents = { };
+		SPSCQueue<Event, EventQueueSize> m_EventQueue = {}; // Note: Hands events from the polling thread to the dispatching thread
+		#if defined(LU_CONFIG_DEBUG)
+		std::atomic<std::thread::id> m_DispatchThread = {}; // Note: Verifies the queue only ever has a single consumer
+		#endif
 		
 		DeferredConstruct<Renderer, true> m_Renderer = {};
 	};
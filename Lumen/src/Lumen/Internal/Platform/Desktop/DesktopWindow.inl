@@ -9,6 +9,11 @@ namespace Lumen::Internal
         LU_MARK_FRAME();
         LU_PROFILE("DesktopWindow::PollEvents()");
         glfwPollEvents();
+
+        if (m_Specification.ThreadedInput)
+            FlushEvents();
+        else
+            DispatchEvents();
     }
 
     hintinline void DesktopWindow::SwapBuffers()
@@ -25,6 +30,12 @@ namespace Lumen::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Getters
     ////////////////////////////////////////////////////////////////////////////////////
+    forceinline Vec2<uint32_t> DesktopWindow::GetSize() const
+    {
+        uint64_t size = m_Size.load(std::memory_order_acquire);
+        return { static_cast<uint32_t>(size >> 32), static_cast<uint32_t>(size) };
+    }
+
     hintinline Vec2<int32_t> DesktopWindow::GetPosition() const
     {
         LU_PROFILE("DesktopWindow::GetPosition()");
@@ -50,7 +61,8 @@ namespace Lumen::Internal
         LU_PROFILE("DesktopWindow::SetVSync()");
 
         m_Specification.VSync = vsync;
-        m_Renderer->Recreate(m_Specification.Width, m_Specification.Height, vsync);
+        Vec2<uint32_t> size = GetSize();
+        m_Renderer->Recreate(size.x, size.y, vsync);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
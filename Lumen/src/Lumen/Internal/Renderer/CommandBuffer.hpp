@@ -21,6 +21,9 @@ namespace Lumen::Internal
 
         // The Begin, End & Submit methods are in the Renderer class.
 
+        // Getters
+        forceinline CommandBufferHandle GetHandle() const { return m_CommandBuffer.GetHandle(); } // Note: What frame graphs refer to
+
         // Internal
         forceinline Type& GetInternalCommandBuffer() { return m_CommandBuffer; }
         forceinline const Type& GetInternalCommandBuffer() const { return m_CommandBuffer; }
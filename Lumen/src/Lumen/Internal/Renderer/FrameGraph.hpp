@@ -1,17 +1,20 @@
 #pragma once
 
 #include "Lumen/Internal/Renderer/RendererSpec.hpp"
+#include "Lumen/Internal/Renderer/CommandBuffer.hpp"
+
+#include "Lumen/Internal/Memory/SmallVector.hpp"
 
 #include "Lumen/Core/Core.hpp"
 
+#include <span>
 #include <cstdint>
 #include <vector>
+#include <memory_resource>
 
 namespace Lumen::Internal
 {
 
-	class CommandBuffer;
-
 	////////////////////////////////////////////////////////////////////////////////////
 	// Waitable
 	////////////////////////////////////////////////////////////////////////////////////
@@ -22,12 +25,12 @@ namespace Lumen::Internal
 	public:
 		WaitOperation Operation = WaitOperation::None;
 
-		CommandBuffer* Command = nullptr;
+		CommandBufferHandle Command = {}; // Note: A handle, so a destroyed command buffer is detected instead of dereferenced
 		Queue UsedQueue = Queue::Graphics;
 
 	public:
 		Waitable() = default;
-		forceinline Waitable(WaitOperation operation, CommandBuffer* command = nullptr, Queue usedQueue = Queue::Graphics)
+		forceinline Waitable(WaitOperation operation, CommandBufferHandle command = {}, Queue usedQueue = Queue::Graphics)
 			: Operation(operation), Command(command), UsedQueue(usedQueue) {}
 		~Waitable() = default;
 	};
@@ -35,21 +38,35 @@ namespace Lumen::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	// GraphElement
 	////////////////////////////////////////////////////////////////////////////////////
-	struct GraphElement
+	struct GraphElement // Note: Allocator aware, so a graph built on a frame arena keeps all of its memory there
 	{
 	public:
-		CommandBuffer* Command = nullptr;
+		using allocator_type = std::pmr::polymorphic_allocator<>;
+	public:
+		CommandBufferHandle Command = {};
 		Queue UsedQueue = Queue::Graphics;
 
-		std::vector<Waitable> WaitOn = { };
+		SmallVector<Waitable, 2> WaitOn = { }; // Note: Most elements wait on 0-2 things, so this rarely allocates
 
 	public:
-		GraphElement() = default;
-		forceinline GraphElement(CommandBuffer* command = nullptr, Queue usedQueue = Queue::Graphics, std::initializer_list<Waitable> waitOn = { })
-			: Command(command), UsedQueue(usedQueue), WaitOn(waitOn) {}
-		forceinline GraphElement(CommandBuffer* command = nullptr, Queue usedQueue = Queue::Graphics, const std::vector<Waitable>& waitOn = { })
-			: Command(command), UsedQueue(usedQueue), WaitOn(waitOn) {}
+		forceinline GraphElement(CommandBufferHandle command = {}, Queue usedQueue = Queue::Graphics, std::initializer_list<Waitable> waitOn = { }, const allocator_type& allocator = { })
+			: Command(command), UsedQueue(usedQueue), WaitOn(waitOn, allocator) {}
+		forceinline GraphElement(CommandBufferHandle command, Queue usedQueue, std::span<const Waitable> waitOn, const allocator_type& allocator = { })
+			: Command(command), UsedQueue(usedQueue), WaitOn(waitOn, allocator) {}
 		~GraphElement() = default;
+
+		// Copy/Move constructors
+		GraphElement(const GraphElement& other) = default;
+		forceinline GraphElement(const GraphElement& other, const allocator_type& allocator)
+			: Command(other.Command), UsedQueue(other.UsedQueue), WaitOn(other.WaitOn, allocator) {}
+		GraphElement(GraphElement&& other) noexcept = default;
+		forceinline GraphElement(GraphElement&& other, const allocator_type& allocator)
+			: Command(other.Command), UsedQueue(other.UsedQueue), WaitOn(std::move(other.WaitOn), allocator) {}
+		GraphElement& operator = (const GraphElement& other) = default;
+		GraphElement& operator = (GraphElement&& other) = default;
+
+		// Getters
+		forceinline allocator_type get_allocator() const { return allocator_type(WaitOn.get_allocator().resource()); }
 	};
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -58,7 +75,12 @@ namespace Lumen::Internal
 	struct FrameGraph // Note: First thing is acquiring the image, Last thing is presenting
 	{
 	public:
-		std::vector<GraphElement> Elements = { };
+		std::pmr::vector<GraphElement> Elements;
+
+	public:
+		forceinline explicit FrameGraph(std::pmr::memory_resource* resource) // Note: Use Renderer::CreateFrameGraph() for graphs that are rebuilt every frame, std::pmr::get_default_resource() for ones that are kept
+			: Elements(resource) {}
+		~FrameGraph() = default;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Lumen/Internal/Renderer/RendererSpec.hpp"
+#include "Lumen/Internal/Renderer/Image.hpp"
+
+#include "Lumen/Internal/Vulkan/VulkanReadback.hpp"
+
+#include <optional>
+
+namespace Lumen::Internal
+{
+
+    using ReadbackResult = VulkanReadbackResult;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Readback
+    ////////////////////////////////////////////////////////////////////////////////////
+    class Readback
+    {
+    public:
+        using Type = VulkanReadbackRing;
+    public:
+        // Constructor & Destructor
+        forceinline Readback(uint32_t slots = RendererSpecification::DefaultFramesInFlight)
+            : m_Readback(slots) {}
+        ~Readback() = default;
+
+        // Methods
+        forceinline uint64_t Enqueue(Image& image) { return m_Readback.Enqueue(image.GetInternalImage()); }
+        forceinline std::optional<ReadbackResult> Poll(bool wait = false) { return m_Readback.Poll(wait); }
+
+        forceinline void Flush() { m_Readback.Flush(); }
+
+        // Getters
+        forceinline uint32_t GetSlotCount() const { return m_Readback.GetSlotCount(); }
+        forceinline uint32_t GetOccupiedCount() const { return m_Readback.GetOccupiedCount(); }
+
+        // Internal
+        forceinline Type& GetInternalReadback() { return m_Readback; }
+
+    private:
+        Type m_Readback;
+    };
+
+}
\ No newline at end of file
@@ -29,9 +29,9 @@ namespace Lumen::Internal
         forceinline void Present() { m_Renderer.Present(); }
 
         // Object methods
-        //inline void Begin(CommandBuffer& cmdBuf) { m_Renderer.Begin(cmdBuf); }
+        forceinline void Begin(CommandBuffer& cmdBuf, const char* name = "CommandBuffer") { m_Renderer.Begin(cmdBuf, name); }
         //inline void Begin(Renderpass& renderpass) { m_Renderer.Begin(renderpass); }
-        //inline void End(CommandBuffer& cmdBuf) { m_Renderer.End(cmdBuf); }
+        forceinline void End(CommandBuffer& cmdBuf) { m_Renderer.End(cmdBuf); }
         //inline void End(Renderpass& renderpass) { m_Renderer.End(renderpass); }
         //inline void Submit(CommandBuffer& cmdBuf, ExecutionPolicy policy, Queue queue = Queue::Graphics, PipelineStage waitStage = PipelineStage::ColourAttachmentOutput, const //std::vector<CommandBuffer*>& waitOn = {}) { m_Renderer.Submit(cmdBuf, policy, queue, waitStage, waitOn); }
         //inline void Submit(Renderpass& renderpass, ExecutionPolicy policy, Queue queue = Queue::Graphics, PipelineStage waitStage = PipelineStage::ColourAttachmentOutput, const std::vector<CommandBuffer*>& waitOn = {}) { m_Renderer.Submit(renderpass, policy, queue, waitStage, waitOn); }
@@ -46,12 +46,19 @@ namespace Lumen::Internal
         // Frame
         forceinline void BakeFrameGraph(const FrameGraph& frame, uint8_t frameIndex) { return m_Renderer.BakeFrameGraph(frame, frameIndex); }
         forceinline void BakeCurrentFrameGraph(const FrameGraph& frame) { return m_Renderer.BakeCurrentFrameGraph(frame); }
+        forceinline FrameGraph CreateFrameGraph() { return FrameGraph(&m_Renderer.GetFrameArena()); } // Note: Lives in the current frame's arena, so it's only valid until this frame slot comes around again
 
         // Internal
         forceinline void Recreate(uint32_t width, uint32_t height, bool vsync) { m_Renderer.Recreate(width, height, vsync); }
 
+        // Setters
+        forceinline void SetFramesInFlight(uint8_t frames) { m_Renderer.SetFramesInFlight(frames); }
+        forceinline void SetLatencyMode(LatencyMode mode) { m_Renderer.SetLatencyMode(mode); }
+
         // Getters
         forceinline const RendererSpecification& GetSpecification() const { return m_Renderer.GetSpecification(); }
+        forceinline const VulkanLatencyStatistics& GetLatencyStatistics() const { return m_Renderer.GetLatencyStatistics(); }
+        forceinline LinearArena& GetFrameArena() { return m_Renderer.GetFrameArena(); }
         
         //inline ImageFormat GetColourFormat() const { return m_Renderer.GetColourFormat(); }
         //inline ImageFormat GetDepthFormat() const { return m_Renderer.GetDepthFormat(); }
@@ -21,19 +21,32 @@ namespace Lumen::Internal
         COUNT
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // LatencyMode
+    ////////////////////////////////////////////////////////////////////////////////////
+    enum class LatencyMode : uint8_t
+    {
+        Throughput = 0, // Queue up to FramesInFlight frames
+        Balanced,       // Queue up to 2 frames
+        Low,            // Queue 1 frame, and pace the CPU on presentation when supported
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // RendererSpecification
     ////////////////////////////////////////////////////////////////////////////////////
     struct RendererSpecification
     {
     public:
-		inline static constexpr const uint8_t FramesInFlight = 3; // 1 - 3 is usual. 
+		inline static constexpr const uint8_t MaxFramesInFlight = 4; // Note: Sizes all per frame resources
+		inline static constexpr const uint8_t DefaultFramesInFlight = 3;
     public:
         Window* WindowRef = nullptr;
         ImageFormat Format = ImageFormat::BGRA;
 
         uint32_t Width = 0, Height = 0;
         bool VSync = true;
+        LatencyMode Latency = LatencyMode::Balanced;
+        uint8_t FramesInFlight = DefaultFramesInFlight; // 1 - MaxFramesInFlight, 1 - 2 for low latency & 3 - 4 for throughput
     };
 
 }
\ No newline at end of file
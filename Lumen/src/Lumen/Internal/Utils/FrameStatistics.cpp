@@ -0,0 +1,147 @@
+#include "lupch.h"
+#include "FrameStatistics.hpp"
+
+#include "Lumen/Internal/IO/Print.hpp"
+
+#include <cmath>
+
+namespace
+{
+
+	static double GetTime() // Note: In milliseconds
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+}
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Getters
+	////////////////////////////////////////////////////////////////////////////////////
+	double FrameSample::Get(FrameMetric metric) const
+	{
+		switch (metric)
+		{
+		case FrameMetric::CPUTime:          return CPUTime;
+		case FrameMetric::GPUTime:          return GPUTime;
+		case FrameMetric::Submits:          return static_cast<double>(Submits);
+		case FrameMetric::Barriers:         return static_cast<double>(Barriers);
+		case FrameMetric::StagingBytes:     return static_cast<double>(StagingBytes);
+		case FrameMetric::GarbageEntries:   return static_cast<double>(GarbageEntries);
+
+		default:
+			LU_ASSERT(false, "[FrameStatistics] Invalid metric passed in.");
+			break;
+		}
+
+		return 0.0;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Static methods
+	////////////////////////////////////////////////////////////////////////////////////
+	uint64_t FrameStatistics::NextFrame()
+	{
+		double now = GetTime();
+
+		if (s_Frame != 0)
+		{
+			FrameSample& sample = s_Samples[s_Frame % HistorySize];
+			sample.Frame = s_Frame;
+			sample.CPUTime = now - s_FrameStart;
+			sample.GPUTime = -1.0;
+			sample.Submits = s_Submits.exchange(0, std::memory_order_relaxed);
+			sample.Barriers = s_Barriers.exchange(0, std::memory_order_relaxed);
+			sample.StagingBytes = s_StagingBytes.exchange(0, std::memory_order_relaxed);
+			sample.GarbageEntries = s_GarbageEntries.exchange(0, std::memory_order_relaxed);
+		}
+
+		s_FrameStart = now;
+		return ++s_Frame;
+	}
+
+	void FrameStatistics::SetGPUTime(uint64_t frame, double milliseconds)
+	{
+		FrameSample& sample = s_Samples[frame % HistorySize];
+		if ((sample.Frame == frame) && (frame < s_Frame))
+			sample.GPUTime = milliseconds;
+	}
+
+	FramePercentiles FrameStatistics::GetPercentiles(FrameMetric metric)
+	{
+		Array<double, HistorySize> values = { };
+		size_t count = 0;
+
+		size_t samples = GetSampleCount();
+		for (uint64_t frame = s_Frame - samples; frame < s_Frame; frame++)
+		{
+			double value = s_Samples[frame % HistorySize].Get(metric);
+			if ((metric == FrameMetric::GPUTime) && (value < 0.0))
+				continue;
+
+			values[count++] = value;
+		}
+
+		if (count == 0)
+			return {};
+
+		// Note: Nearest rank, each nth_element only has to partition what's above the previous percentile
+		auto rank = [count](double percentile) -> size_t { return std::max<size_t>(static_cast<size_t>(std::ceil(percentile * static_cast<double>(count))), 1) - 1; };
+		size_t p50 = rank(0.50), p95 = rank(0.95), p99 = rank(0.99);
+
+		std::nth_element(values.begin(), values.begin() + p50, values.begin() + count);
+		std::nth_element(values.begin() + p50, values.begin() + p95, values.begin() + count);
+		std::nth_element(values.begin() + p95, values.begin() + p99, values.begin() + count);
+
+		FramePercentiles percentiles = {};
+		percentiles.P50 = values[p50];
+		percentiles.P95 = values[p95];
+		percentiles.P99 = values[p99];
+
+		return percentiles;
+	}
+
+	const FrameSample* FrameStatistics::GetSample(uint64_t frame)
+	{
+		const FrameSample& sample = s_Samples[frame % HistorySize];
+		if ((sample.Frame != frame) || (frame >= s_Frame) || (frame == 0))
+			return nullptr;
+
+		return &sample;
+	}
+
+	size_t FrameStatistics::GetSampleCount()
+	{
+		if (s_Frame == 0)
+			return 0;
+
+		return static_cast<size_t>(std::min<uint64_t>(s_Frame - 1, HistorySize));
+	}
+
+	bool FrameStatistics::DumpCSV(std::string_view path)
+	{
+		std::ofstream file = std::ofstream(std::string(path), std::ios::out | std::ios::trunc);
+		if (!file.is_open())
+		{
+			LU_LOG_ERROR("[FrameStatistics] Failed to open '{0}' for writing.", path);
+			return false;
+		}
+
+		file << "Frame,CPUTime,GPUTime,Submits,Barriers,StagingBytes,GarbageEntries\n";
+
+		size_t samples = GetSampleCount();
+		for (uint64_t frame = s_Frame - samples; frame < s_Frame; frame++)
+		{
+			const FrameSample& sample = s_Samples[frame % HistorySize];
+			std::string gpuTime = ((sample.GPUTime < 0.0) ? std::string() : std::format("{0:.4f}", sample.GPUTime)); // Note: Empty if it never got read back
+
+			file << std::format("{0},{1:.4f},{2},{3},{4},{5},{6}\n", sample.Frame, sample.CPUTime, gpuTime, sample.Submits, sample.Barriers, sample.StagingBytes, sample.GarbageEntries);
+		}
+
+		return file.good();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Lumen/Internal/Memory/Array.hpp"
+
+#include "Lumen/Core/Core.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// FrameSample
+	////////////////////////////////////////////////////////////////////////////////////
+	enum class FrameMetric : uint8_t { CPUTime = 0, GPUTime, Submits, Barriers, StagingBytes, GarbageEntries, Count };
+
+	struct FrameSample
+	{
+	public:
+		uint64_t Frame = 0;
+
+		double CPUTime = 0.0;           // Milliseconds from the start of this frame to the start of the next
+		double GPUTime = -1.0;          // Milliseconds the frame's command buffer took on the GPU, negative until it has been read back
+		uint32_t Submits = 0;
+		uint32_t Barriers = 0;          // Note: Counts individual barriers, not vkCmdPipelineBarrier calls
+		uint64_t StagingBytes = 0;      // Bytes copied into staging buffers
+		uint32_t GarbageEntries = 0;    // Entries disposed by the garbage collector
+
+	public:
+		// Getters
+		double Get(FrameMetric metric) const;
+	};
+
+	struct FramePercentiles
+	{
+	public:
+		double P50 = 0.0;
+		double P95 = 0.0;
+		double P99 = 0.0;
+	};
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// FrameStatistics
+	////////////////////////////////////////////////////////////////////////////////////
+	class FrameStatistics // Note: Always enabled, independent of the profiler. The counters may be incremented from any thread, everything else belongs to the render thread
+	{
+	public:
+		// Settings
+		inline constexpr static const size_t HistorySize = 1024; // Note: Amount of frames kept
+	public:
+		// Counters
+		forceinline static void AddSubmits(uint32_t count = 1) { s_Submits.fetch_add(count, std::memory_order_relaxed); }
+		forceinline static void AddBarriers(uint32_t count = 1) { s_Barriers.fetch_add(count, std::memory_order_relaxed); }
+		forceinline static void AddStagingBytes(uint64_t bytes) { s_StagingBytes.fetch_add(bytes, std::memory_order_relaxed); }
+		forceinline static void AddGarbageEntries(uint32_t count) { s_GarbageEntries.fetch_add(count, std::memory_order_relaxed); }
+
+		// Static methods
+		static uint64_t NextFrame(); // Note: Called by the renderer at the start of every frame, closes the previous frame's sample
+		static void SetGPUTime(uint64_t frame, double milliseconds); // Note: Ignored if the frame is no longer in the history
+
+		static FramePercentiles GetPercentiles(FrameMetric metric); // Note: Over all closed frames in the history, frames without a GPU time are skipped
+		static const FrameSample* GetSample(uint64_t frame); // Note: Returns nullptr if the frame isn't closed or no longer in the history
+		static size_t GetSampleCount();
+		forceinline static uint64_t GetCurrentFrame() { return s_Frame; } // Note: 0 before the first frame
+
+		static bool DumpCSV(std::string_view path); // Note: Oldest frame first
+
+	private:
+		inline static Array<FrameSample, HistorySize> s_Samples = { };
+
+		inline static uint64_t s_Frame = 0;
+		inline static double s_FrameStart = 0.0;
+
+		inline static std::atomic<uint32_t> s_Submits = 0;
+		inline static std::atomic<uint32_t> s_Barriers = 0;
+		inline static std::atomic<uint64_t> s_StagingBytes = 0;
+		inline static std::atomic<uint32_t> s_GarbageEntries = 0;
+	};
+
+}
\ No newline at end of file
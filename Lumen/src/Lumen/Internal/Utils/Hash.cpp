@@ -0,0 +1,206 @@
+#include "lupch.h"
+#include "Hash.hpp"
+
+#include "Lumen/Core/Core.hpp"
+
+#include <array>
+
+// Note: SSE2 is part of x86-64, AVX2 isn't, so its path is compiled for that function only & picked at runtime
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <immintrin.h>
+    #define LU_HASH_AVX2
+    #define LU_HASH_SSE2
+
+    #if defined(LU_COMPILER_MSVC)
+        #include <intrin.h>
+        #define LU_HASH_AVX2_TARGET
+    #else
+        #define LU_HASH_AVX2_TARGET __attribute__((target("avx2")))
+    #endif
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+    #define LU_HASH_SSE2
+#endif
+
+namespace
+{
+
+	using namespace Lumen::Internal;
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Stripes
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: Each path processes a 64 byte stripe as 8 lanes, which must match Hash::AccumulateScalar & Hash::ScrambleScalar
+	#if defined(LU_HASH_AVX2)
+	forceinline bool HasAVX2()
+	{
+		#if defined(__AVX2__)
+		return true;
+		#elif defined(LU_COMPILER_MSVC)
+		static const bool s_AVX2 = []()
+		{
+			std::array<int, 4> info = { };
+			__cpuid(info.data(), 0);
+			if (info[0] < 7)
+				return false;
+
+			// Note: AVX2 is only usable if the OS saves the YMM registers (OSXSAVE & AVX, then XCR0)
+			__cpuid(info.data(), 1);
+			if (((info[2] & (1 << 27)) == 0) || ((info[2] & (1 << 28)) == 0) || ((_xgetbv(0) & 0x6) != 0x6))
+				return false;
+
+			__cpuidex(info.data(), 7, 0);
+			return ((info[1] & (1 << 5)) != 0);
+		}();
+		return s_AVX2;
+		#else
+		static const bool s_AVX2 = []()
+		{
+			__builtin_cpu_init();
+			return (__builtin_cpu_supports("avx2") != 0);
+		}();
+		return s_AVX2;
+		#endif
+	}
+
+	LU_HASH_AVX2_TARGET uint64_t AccumulateLongAVX2(const char* data, size_t size, uint64_t seed)
+	{
+		const __m256i* keys = reinterpret_cast<const __m256i*>(Hash::Keys);
+		const __m256i prime = _mm256_set1_epi64x(static_cast<int64_t>(Hash::ScramblePrime));
+
+		alignas(32) uint64_t accumulators[8] = { Hash::Primes[0], Hash::Primes[1], Hash::Primes[2], Hash::Primes[3], Hash::Primes[0] ^ seed, Hash::Primes[1] ^ seed, Hash::Primes[2] ^ seed, Hash::Primes[3] ^ seed };
+		__m256i lanes[2] = { _mm256_load_si256(reinterpret_cast<const __m256i*>(accumulators)), _mm256_load_si256(reinterpret_cast<const __m256i*>(accumulators + 4)) };
+
+		auto accumulate = [&](const char* stripe) LU_HASH_AVX2_TARGET
+		{
+			for (size_t i = 0; i < 2; i++)
+			{
+				__m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripe) + i);
+				__m256i key = _mm256_xor_si256(value, _mm256_loadu_si256(keys + i));
+
+				__m256i product = _mm256_mul_epu32(key, _mm256_srli_epi64(key, 32));
+				__m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+
+				lanes[i] = _mm256_add_epi64(lanes[i], _mm256_add_epi64(product, swapped));
+			}
+		};
+
+		size_t stripes = (size - 1) / Hash::StripeSize;
+		for (size_t s = 0; s < stripes; s++)
+		{
+			accumulate(data + s * Hash::StripeSize);
+
+			if ((s % Hash::ScrambleStripes) == (Hash::ScrambleStripes - 1))
+			{
+				for (size_t i = 0; i < 2; i++)
+				{
+					__m256i value = _mm256_xor_si256(lanes[i], _mm256_srli_epi64(lanes[i], 47));
+					value = _mm256_xor_si256(value, _mm256_loadu_si256(keys + i));
+
+					__m256i low = _mm256_mul_epu32(value, prime);
+					__m256i high = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), prime);
+					lanes[i] = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+				}
+			}
+		}
+
+		accumulate(data + size - Hash::StripeSize);
+
+		_mm256_store_si256(reinterpret_cast<__m256i*>(accumulators), lanes[0]);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(accumulators + 4), lanes[1]);
+
+		return Hash::MergeScalar(accumulators, seed);
+	}
+	#endif
+
+	#if defined(LU_HASH_SSE2)
+	uint64_t AccumulateLong(const char* data, size_t size, uint64_t seed)
+	{
+		#if defined(LU_HASH_AVX2)
+		if (HasAVX2()) [[likely]]
+			return AccumulateLongAVX2(data, size, seed);
+		#endif
+
+		const __m128i* keys = reinterpret_cast<const __m128i*>(Hash::Keys);
+		const __m128i prime = _mm_set1_epi64x(static_cast<int64_t>(Hash::ScramblePrime));
+
+		alignas(16) uint64_t accumulators[8] = { Hash::Primes[0], Hash::Primes[1], Hash::Primes[2], Hash::Primes[3], Hash::Primes[0] ^ seed, Hash::Primes[1] ^ seed, Hash::Primes[2] ^ seed, Hash::Primes[3] ^ seed };
+		__m128i lanes[4] = { };
+		for (size_t i = 0; i < 4; i++)
+			lanes[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(accumulators) + i);
+
+		auto accumulate = [&](const char* stripe)
+		{
+			for (size_t i = 0; i < 4; i++)
+			{
+				__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripe) + i);
+				__m128i key = _mm_xor_si128(value, _mm_loadu_si128(keys + i));
+
+				__m128i product = _mm_mul_epu32(key, _mm_srli_epi64(key, 32));
+				__m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+
+				lanes[i] = _mm_add_epi64(lanes[i], _mm_add_epi64(product, swapped));
+			}
+		};
+
+		size_t stripes = (size - 1) / Hash::StripeSize;
+		for (size_t s = 0; s < stripes; s++)
+		{
+			accumulate(data + s * Hash::StripeSize);
+
+			if ((s % Hash::ScrambleStripes) == (Hash::ScrambleStripes - 1))
+			{
+				for (size_t i = 0; i < 4; i++)
+				{
+					__m128i value = _mm_xor_si128(lanes[i], _mm_srli_epi64(lanes[i], 47));
+					value = _mm_xor_si128(value, _mm_loadu_si128(keys + i));
+
+					__m128i low = _mm_mul_epu32(value, prime);
+					__m128i high = _mm_mul_epu32(_mm_srli_epi64(value, 32), prime);
+					lanes[i] = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+				}
+			}
+		}
+
+		accumulate(data + size - Hash::StripeSize);
+
+		for (size_t i = 0; i < 4; i++)
+			_mm_store_si128(reinterpret_cast<__m128i*>(accumulators) + i, lanes[i]);
+
+		return Hash::MergeScalar(accumulators, seed);
+	}
+	#else
+	uint64_t AccumulateLong(const char* data, size_t size, uint64_t seed)
+	{
+		return Hash::LongScalar(data, size, seed);
+	}
+	#endif
+
+}
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Internal
+	////////////////////////////////////////////////////////////////////////////////////
+	uint64_t Hash::Long(const char* data, size_t size, uint64_t seed)
+	{
+		return AccumulateLong(data, size, seed);
+	}
+
+	std::string_view Hash::GetLongPath()
+	{
+		#if defined(LU_HASH_AVX2)
+		if (HasAVX2())
+			return "AVX2";
+		#endif
+
+		#if defined(LU_HASH_SSE2)
+		return "SSE2";
+		#else
+		return "scalar";
+		#endif
+	}
+
+}
\ No newline at end of file
@@ -1,13 +1,30 @@
 #pragma once
 
+#include "Lumen/Internal/Utils/Preprocessor.hpp"
+
 #include <cstdint>
+#include <cstring>
 #include <string_view>
+#include <type_traits>
+
+#if defined(LU_COMPILER_MSVC)
+    #include <intrin.h>
+#endif
 
 namespace Lumen::Internal
 {
 
 	class Hash
 	{
+    public:
+        // Settings
+        inline constexpr static const size_t StripeSize = 64; // Note: Bytes per step of the long input path
+        inline constexpr static const size_t ScrambleStripes = 16; // Note: Stripes between accumulator scrambles
+        inline constexpr static const size_t LongThreshold = 256; // Note: Inputs above this size use the stripe path
+
+        inline constexpr static const uint64_t Primes[4] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+        inline constexpr static const uint64_t Keys[8] = { 0xbe4ba423396cfeb8ull, 0x1cad21f72c81017cull, 0xdb979083e96dd4deull, 0x1f67b3b7a4a44072ull, 0x78e5c0cc4ee679cbull, 0x2172ffcc7dd05a82ull, 0x8e2443f7744608b8ull, 0x4c263a81e69035e0ull };
+        inline constexpr static const uint64_t ScramblePrime = 0x9e3779b1ull;
     public:
         // Hash functions
         static constexpr size_t fnv1a(const std::string_view str)
@@ -16,7 +33,7 @@ namespace Lumen::Internal
             constexpr size_t offsetBasis = 14695981039346656037ULL;
 
             size_t hash = offsetBasis;
-            for (char c : str) 
+            for (char c : str)
             {
                 hash ^= static_cast<size_t>(c);
                 hash *= fnvPrime;
@@ -25,6 +42,27 @@ namespace Lumen::Internal
             return hash;
         }
 
+        // Note: Runtime hash for cache keys, processes 16-48 bytes per step (64 for long inputs, SIMD if available).
+        //       The result is the same at compile time and on every path, but it's not fnv1a, so don't mix them.
+        static constexpr uint64_t Fast(const std::string_view str, uint64_t seed = 0)
+        {
+            if (std::is_constant_evaluated())
+                return FastImpl(str.data(), str.size(), seed);
+
+            return Fast(str.data(), str.size(), seed);
+        }
+
+        static uint64_t Fast(const void* data, size_t size, uint64_t seed = 0)
+        {
+            return FastImpl(static_cast<const char*>(data), size, seed);
+        }
+
+        template<typename T> requires(std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>)
+        static uint64_t Fast(const T& value, uint64_t seed = 0) // Note: Only for types without padding, since padding bytes are indeterminate
+        {
+            return Fast(&value, sizeof(T), seed);
+        }
+
     public:
         // Helper functions
         static constexpr size_t Combine(const size_t hash1, const size_t hash2)
@@ -35,6 +73,182 @@ namespace Lumen::Internal
 
             return combined ^ (combined >> 31);
         }
+
+    public:
+        // Internal
+        static constexpr uint64_t Mix(uint64_t a, uint64_t b) // Note: Folded 64x64 -> 128 bit multiply
+        {
+            #if defined(LU_COMPILER_MSVC)
+            if (!std::is_constant_evaluated())
+            {
+                uint64_t high = 0;
+                uint64_t low = _umul128(a, b, &high);
+                return low ^ high;
+            }
+
+            uint64_t aLow = a & 0xffffffffull, aHigh = a >> 32;
+            uint64_t bLow = b & 0xffffffffull, bHigh = b >> 32;
+            uint64_t lowLow = aLow * bLow, lowHigh = aLow * bHigh, highLow = aHigh * bLow, highHigh = aHigh * bHigh;
+
+            uint64_t middle = (lowLow >> 32) + (lowHigh & 0xffffffffull) + (highLow & 0xffffffffull);
+            uint64_t low = (lowLow & 0xffffffffull) | (middle << 32);
+            uint64_t high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+
+            return low ^ high;
+            #else
+            __uint128_t product = static_cast<__uint128_t>(a) * b;
+            return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+            #endif
+        }
+
+        static constexpr uint64_t Read64(const char* data)
+        {
+            if (std::is_constant_evaluated())
+            {
+                uint64_t value = 0;
+                for (size_t i = 0; i < 8; i++)
+                    value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (i * 8);
+                return value;
+            }
+
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value)); // Note: Assumes little endian, like the rest of the engine
+            return value;
+        }
+
+        static constexpr uint64_t Read32(const char* data)
+        {
+            if (std::is_constant_evaluated())
+            {
+                uint64_t value = 0;
+                for (size_t i = 0; i < 4; i++)
+                    value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (i * 8);
+                return value;
+            }
+
+            uint32_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        static constexpr uint64_t FastImpl(const char* data, size_t size, uint64_t seed)
+        {
+            seed ^= Mix(seed ^ Primes[0], Primes[1]);
+
+            uint64_t a = 0, b = 0;
+            if (size <= 16) [[likely]]
+            {
+                if (size >= 4)
+                {
+                    // Note: Two overlapping reads from both ends cover every length from 4 to 16
+                    size_t offset = (size >> 3) << 2;
+                    a = (Read32(data) << 32) | Read32(data + offset);
+                    b = (Read32(data + size - 4) << 32) | Read32(data + size - 4 - offset);
+                }
+                else if (size > 0)
+                {
+                    a = (static_cast<uint64_t>(static_cast<uint8_t>(data[0])) << 16) | (static_cast<uint64_t>(static_cast<uint8_t>(data[size >> 1])) << 8) | static_cast<uint64_t>(static_cast<uint8_t>(data[size - 1]));
+                }
+            }
+            else if (size <= LongThreshold)
+            {
+                size_t remaining = size;
+                if (remaining > 48)
+                {
+                    uint64_t seed1 = seed, seed2 = seed;
+                    do
+                    {
+                        seed = Mix(Read64(data) ^ Primes[1], Read64(data + 8) ^ seed);
+                        seed1 = Mix(Read64(data + 16) ^ Primes[2], Read64(data + 24) ^ seed1);
+                        seed2 = Mix(Read64(data + 32) ^ Primes[3], Read64(data + 40) ^ seed2);
+
+                        data += 48;
+                        remaining -= 48;
+                    } while (remaining > 48);
+
+                    seed ^= seed1 ^ seed2;
+                }
+
+                while (remaining > 16)
+                {
+                    seed = Mix(Read64(data) ^ Primes[1], Read64(data + 8) ^ seed);
+
+                    data += 16;
+                    remaining -= 16;
+                }
+
+                a = Read64(data + remaining - 16);
+                b = Read64(data + remaining - 8);
+            }
+            else
+            {
+                if (std::is_constant_evaluated())
+                    seed = LongScalar(data, size, seed);
+                else
+                    seed = Long(data, size, seed);
+
+                a = Read64(data + size - 16);
+                b = Read64(data + size - 8);
+            }
+
+            a ^= Primes[1];
+            b ^= seed;
+            return Mix(Primes[0] ^ size, Mix(a, b) ^ Primes[1]);
+        }
+
+        // Note: The stripe accumulator, the SIMD paths in Hash.cpp must produce the exact same result
+        static constexpr void AccumulateScalar(uint64_t (&accumulators)[8], const char* stripe)
+        {
+            for (size_t i = 0; i < 8; i++)
+            {
+                uint64_t value = Read64(stripe + i * 8);
+                uint64_t key = value ^ Keys[i];
+
+                accumulators[i ^ 1] += value;
+                accumulators[i] += (key & 0xffffffffull) * (key >> 32);
+            }
+        }
+
+        static constexpr void ScrambleScalar(uint64_t (&accumulators)[8])
+        {
+            for (size_t i = 0; i < 8; i++)
+            {
+                uint64_t value = accumulators[i];
+                value ^= value >> 47;
+                value ^= Keys[i];
+                accumulators[i] = value * ScramblePrime;
+            }
+        }
+
+        static constexpr uint64_t MergeScalar(const uint64_t (&accumulators)[8], uint64_t seed)
+        {
+            for (size_t i = 0; i < 8; i += 2)
+                seed = Mix(accumulators[i] ^ Keys[i] ^ seed, accumulators[i + 1] ^ Keys[i + 1]);
+
+            return seed;
+        }
+
+        static constexpr uint64_t LongScalar(const char* data, size_t size, uint64_t seed)
+        {
+            uint64_t accumulators[8] = { Primes[0], Primes[1], Primes[2], Primes[3], Primes[0] ^ seed, Primes[1] ^ seed, Primes[2] ^ seed, Primes[3] ^ seed };
+
+            size_t stripes = (size - 1) / StripeSize;
+            for (size_t i = 0; i < stripes; i++)
+            {
+                AccumulateScalar(accumulators, data + i * StripeSize);
+
+                if ((i % ScrambleStripes) == (ScrambleStripes - 1))
+                    ScrambleScalar(accumulators);
+            }
+
+            // Note: The last stripe overlaps the previous one, so partial stripes don't need special handling
+            AccumulateScalar(accumulators, data + size - StripeSize);
+
+            return MergeScalar(accumulators, seed);
+        }
+
+        static uint64_t Long(const char* data, size_t size, uint64_t seed); // Note: Defined in Hash.cpp, uses AVX2 or SSE2 when available
+        static std::string_view GetLongPath(); // Note: The path Long picks at runtime, "AVX2", "SSE2" or "scalar"
 	};
 
 }
\ No newline at end of file
@@ -3,28 +3,189 @@
 
 #include "Lumen/Internal/IO/Print.hpp"
 
-#if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING
-    #if LU_MEM_PROFILING
-        void* operator new(size_t size)
-        {
-            auto ptr = std::malloc(size);
-            if (!ptr)
-                throw std::bad_alloc();
-
-            TracyAlloc(ptr, size);
-            return ptr;
-        }
-
-        void operator delete(void* ptr) noexcept
-        {
-            TracyFree(ptr);
-            std::free(ptr);
-        }
-
-        void operator delete(void* ptr, size_t size) noexcept
-        {
-            TracyFree(ptr);
-            std::free(ptr);
-        }
-    #endif
+#include "Lumen/Internal/Memory/Array.hpp"
+
+#include <atomic>
+
+namespace
+{
+
+	using namespace Lumen::Internal;
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Tags
+	////////////////////////////////////////////////////////////////////////////////////
+	inline constexpr const size_t TagCount = static_cast<size_t>(MemoryTag::Count);
+
+	// Note: Tracy identifies pools by the address of their name, so these must stay alive
+	inline constexpr const Array<const char*, TagCount> s_TagNames = { "Untagged", "Renderer", "Images", "Events", "Logging" };
+
+	#if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING && LU_MEM_PROFILING
+	struct TagCounters
+	{
+	public:
+		std::atomic<int64_t> Bytes = 0;
+		std::atomic<uint64_t> Allocations = 0;
+		std::atomic<uint64_t> Frees = 0;
+	};
+
+	static Array<TagCounters, TagCount> s_Counters = { };
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Blocks
+	////////////////////////////////////////////////////////////////////////////////////
+	inline constexpr const size_t HeaderSize = 16; // Note: Keeps the default new alignment
+
+	struct BlockHeader // Note: Lives right before the returned pointer, so frees know the size & tag
+	{
+	public:
+		uint64_t Size = 0;
+		MemoryTag Tag = MemoryTag::Untagged;
+	};
+	static_assert((sizeof(BlockHeader) <= HeaderSize), "BlockHeader must fit in the reserved header space.");
+	static_assert((HeaderSize >= __STDCPP_DEFAULT_NEW_ALIGNMENT__), "The header must preserve the default new alignment.");
+
+	forceinline size_t GetOffset(size_t alignment)
+	{
+		return std::max(alignment, HeaderSize);
+	}
+
+	forceinline BlockHeader* GetHeader(void* memory)
+	{
+		return reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(memory) - sizeof(BlockHeader));
+	}
+
+	void* Allocate(size_t size, size_t alignment)
+	{
+		size_t offset = GetOffset(alignment);
+		void* base = nullptr;
+
+		if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			base = std::malloc(size + offset);
+		}
+		else
+		{
+			#if defined(LU_PLATFORM_WINDOWS)
+			base = _aligned_malloc(size + offset, alignment);
+			#else
+			base = std::aligned_alloc(alignment, ((size + offset + alignment - 1) / alignment) * alignment); // Note: The size must be a multiple of the alignment
+			#endif
+		}
+
+		if (!base) [[unlikely]]
+			return nullptr;
+
+		void* memory = static_cast<uint8_t*>(base) + offset;
+		MemoryTag tag = MemoryTagScope::GetCurrent();
+
+		BlockHeader* header = GetHeader(memory);
+		header->Size = size;
+		header->Tag = tag;
+
+		TagCounters& counters = s_Counters[static_cast<size_t>(tag)];
+		counters.Bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+		counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+
+		TracyAllocN(memory, size, s_TagNames[static_cast<size_t>(tag)]);
+		return memory;
+	}
+
+	void Free(void* memory, size_t alignment)
+	{
+		if (!memory)
+			return;
+
+		BlockHeader* header = GetHeader(memory);
+		MemoryTag tag = header->Tag;
+
+		TagCounters& counters = s_Counters[static_cast<size_t>(tag)];
+		counters.Bytes.fetch_sub(static_cast<int64_t>(header->Size), std::memory_order_relaxed);
+		counters.Frees.fetch_add(1, std::memory_order_relaxed);
+
+		TracyFreeN(memory, s_TagNames[static_cast<size_t>(tag)]);
+
+		void* base = static_cast<uint8_t*>(memory) - GetOffset(alignment);
+		if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			std::free(base);
+		}
+		else
+		{
+			#if defined(LU_PLATFORM_WINDOWS)
+			_aligned_free(base);
+			#else
+			std::free(base);
+			#endif
+		}
+	}
+
+	void* AllocateOrThrow(size_t size, size_t alignment)
+	{
+		void* memory = Allocate(size, alignment);
+		if (!memory) [[unlikely]]
+			throw std::bad_alloc();
+
+		return memory;
+	}
+	#endif
+
+}
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Static methods
+	////////////////////////////////////////////////////////////////////////////////////
+	const char* MemoryTagScope::GetName(MemoryTag tag)
+	{
+		LU_ASSERT((tag < MemoryTag::Count), "[MemoryTagScope] Invalid tag passed in.");
+		return s_TagNames[static_cast<size_t>(tag)];
+	}
+
+	MemoryTagStatistics MemoryTagScope::GetStatistics([[maybe_unused]] MemoryTag tag)
+	{
+		MemoryTagStatistics statistics = {};
+
+		#if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING && LU_MEM_PROFILING
+		LU_ASSERT((tag < MemoryTag::Count), "[MemoryTagScope] Invalid tag passed in.");
+
+		const TagCounters& counters = s_Counters[static_cast<size_t>(tag)];
+		statistics.Bytes = counters.Bytes.load(std::memory_order_relaxed);
+		statistics.Allocations = counters.Allocations.load(std::memory_order_relaxed);
+		statistics.Frees = counters.Frees.load(std::memory_order_relaxed);
+		#endif
+
+		return statistics;
+	}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Global operators
+////////////////////////////////////////////////////////////////////////////////////
+#if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING && LU_MEM_PROFILING
+    // Note: The array and nothrow versions forward to these by default
+    void* operator new(size_t size) { return AllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+    void* operator new(size_t size, std::align_val_t alignment) { return AllocateOrThrow(size, static_cast<size_t>(alignment)); }
+
+    void* operator new[](size_t size) { return AllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+    void* operator new[](size_t size, std::align_val_t alignment) { return AllocateOrThrow(size, static_cast<size_t>(alignment)); }
+
+    void* operator new(size_t size, const std::nothrow_t&) noexcept { return Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+    void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return Allocate(size, static_cast<size_t>(alignment)); }
+
+    void operator delete(void* ptr) noexcept { Free(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+    void operator delete(void* ptr, size_t) noexcept { Free(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+    void operator delete(void* ptr, std::align_val_t alignment) noexcept { Free(ptr, static_cast<size_t>(alignment)); }
+    void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept { Free(ptr, static_cast<size_t>(alignment)); }
+
+    void operator delete[](void* ptr) noexcept { Free(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+    void operator delete[](void* ptr, size_t) noexcept { Free(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+    void operator delete[](void* ptr, std::align_val_t alignment) noexcept { Free(ptr, static_cast<size_t>(alignment)); }
+    void operator delete[](void* ptr, size_t, std::align_val_t alignment) noexcept { Free(ptr, static_cast<size_t>(alignment)); }
+
+    void operator delete(void* ptr, const std::nothrow_t&) noexcept { Free(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+    void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept { Free(ptr, static_cast<size_t>(alignment)); }
 #endif
\ No newline at end of file
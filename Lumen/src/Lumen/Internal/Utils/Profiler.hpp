@@ -9,6 +9,7 @@
 // Note: Internal header, may break in future versions.
 #include <tracy/../client/TracyProfiler.hpp>
 
+#include <cstdint>
 #include <cstdlib>
 #include <string>
 #include <new>
@@ -35,6 +36,39 @@ namespace Lumen::Internal
 		}
 	};
 
+	////////////////////////////////////////////////////////////////////////////////////
+	// Memory tags
+	////////////////////////////////////////////////////////////////////////////////////
+	enum class MemoryTag : uint8_t { Untagged = 0, Renderer, Images, Events, Logging, Count };
+
+	struct MemoryTagStatistics
+	{
+	public:
+		int64_t Bytes = 0;          // Currently allocated
+		uint64_t Allocations = 0;   // Total, never decreases
+		uint64_t Frees = 0;         // Total, never decreases
+	};
+
+	class MemoryTagScope // Note: Allocations on this thread are attributed to the tag until the scope ends, frees always go to the allocating tag
+	{
+	public:
+		// Constructor & Destructor
+		forceinline MemoryTagScope(MemoryTag tag)
+			: m_Previous(s_Current) { s_Current = tag; }
+		forceinline ~MemoryTagScope() { s_Current = m_Previous; }
+
+		// Static methods
+		forceinline static MemoryTag GetCurrent() { return s_Current; }
+
+		static const char* GetName(MemoryTag tag); // Note: Also the name of the tag's Tracy memory pool
+		static MemoryTagStatistics GetStatistics(MemoryTag tag); // Note: Always empty if LU_MEM_PROFILING is disabled
+
+	private:
+		MemoryTag m_Previous;
+
+		inline static thread_local MemoryTag s_Current = MemoryTag::Untagged;
+	};
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Macros
 	////////////////////////////////////////////////////////////////////////////////////
@@ -47,20 +81,26 @@ namespace Lumen::Internal
 		#define LU_MARK_FRAME() FrameMark
 		
 		#define LU_PROFILE(name) ZoneScopedN(name)
+		#define LU_PROFILE_PLOT(name, value) TracyPlot(name, value)
 		
 		#define LU_PROFILER_WAIT_INIT() ::Lumen::Internal::Profiler::Wait()
 
 		#if LU_MEM_PROFILING
-			void* operator new(size_t size);
-			void operator delete(void* ptr) noexcept;
-			void operator delete(void* ptr, size_t size) noexcept;
+			#define LU_MEM_TAG_IMPL2(tag, num) ::Lumen::Internal::MemoryTagScope memoryTag##num(::Lumen::Internal::MemoryTag::tag)
+			#define LU_MEM_TAG_IMPL(tag, num) LU_MEM_TAG_IMPL2(tag, num)
+			#define LU_MEM_TAG(tag) LU_MEM_TAG_IMPL(tag, __COUNTER__)
+		#else
+			#define LU_MEM_TAG(tag)
 		#endif
 	#else
 		#define LU_MARK_FRAME()
 
 		#define LU_PROFILE(name)
+		#define LU_PROFILE_PLOT(name, value)
 
 		#define LU_PROFILER_WAIT_INIT()
+
+		#define LU_MEM_TAG(tag)
 	#endif
 
 }
\ No newline at end of file
@@ -5,7 +5,9 @@
 #include "Lumen/Internal/Utils/Profiler.hpp"
 #include "Lumen/Internal/Utils/Settings.hpp"
 
+#include "Lumen/Internal/Vulkan/VulkanImage.hpp"
 #include "Lumen/Internal/Vulkan/VulkanContext.hpp"
+#include "Lumen/Internal/Vulkan/VulkanHostAllocator.hpp"
 
 #if defined(LU_COMPILER_GCC)
 	#pragma GCC diagnostic push
@@ -34,21 +36,26 @@ namespace
 {
 
     ////////////////////////////////////////////////////////////////////////////////////
-    // Callbacks
+    // Helpers
     ////////////////////////////////////////////////////////////////////////////////////
-    static void* VKAPI_PTR VmaAllocFn(void*, size_t size, size_t, VkSystemAllocationScope)
+    static VkImageCreateInfo GetImageCreateInfo(uint32_t width, uint32_t height, uint32_t mipLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage)
     {
-        return std::malloc(size);
-    }
-
-    static void VKAPI_PTR VmaFreeFn(void*, void* pMemory)
-    {
-        std::free(pMemory);
-    }
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent.width = width;
+        imageInfo.extent.height = height;
+        imageInfo.extent.depth = 1;
+        imageInfo.mipLevels = mipLevels;
+        imageInfo.arrayLayers = 1;
+        imageInfo.format = format;
+        imageInfo.tiling = tiling;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = usage;
+		imageInfo.samples = VK_SAMPLE_COUNT_1_BIT; // Note/TODO: This should maybe be made a parameter
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE; // Note: On most modern system all queue family indices are the same for graphics & compute, so we can use exclusive sharing mode between these queue's (since they are the same). If you need to use different queue families, then you need to use concurrent sharing mode and specify the queue family indices in the pQueueFamilyIndices field.
 
-    static void* VKAPI_PTR VmaReallocFn(void*, void* pOriginal, size_t size, size_t, VkSystemAllocationScope)
-    {
-        return std::realloc(pOriginal, size);
+        return imageInfo;
     }
 
 }
@@ -61,29 +68,138 @@ namespace Lumen::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     void VulkanAllocator::Init()
     {
-        VkAllocationCallbacks callbacks = {};
-        callbacks.pUserData = nullptr;
-        callbacks.pfnAllocation = &VmaAllocFn;
-        callbacks.pfnFree = &VmaFreeFn;
-        callbacks.pfnReallocation = &VmaReallocFn;
-        callbacks.pfnInternalAllocation = nullptr;
-        callbacks.pfnInternalFree = nullptr;
+        s_BudgetExtension = VulkanContext::GetVulkanDevice().IsExtensionEnabled(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
 
         VmaAllocatorCreateInfo allocatorInfo = {};
+        allocatorInfo.flags = (s_BudgetExtension ? VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT : 0);
+        allocatorInfo.vulkanApiVersion = VK_MAKE_API_VERSION(0, std::get<0>(VulkanContext::Version), std::get<1>(VulkanContext::Version), 0);
         allocatorInfo.instance = VulkanContext::GetVkInstance();
         allocatorInfo.physicalDevice = VulkanContext::GetVulkanPhysicalDevice().GetVkPhysicalDevice();
         allocatorInfo.device = VulkanContext::GetVulkanDevice().GetVkDevice();
-        allocatorInfo.pAllocationCallbacks = &callbacks;
+        allocatorInfo.pAllocationCallbacks = VulkanHostAllocator::GetCallbacks();
 
         VK_VERIFY(vmaCreateAllocator(&allocatorInfo, &s_Allocator));
+        InitPools();
+
+        if (!s_BudgetExtension)
+            LU_LOG_WARN("[VkAllocator] {0} is not supported, heap usage & budget will be estimated.", VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
     }
 
     void VulkanAllocator::Destroy()
     {
+        for (VmaPool& pool : s_Pools)
+        {
+            if (pool != VK_NULL_HANDLE)
+                vmaDestroyPool(s_Allocator, pool);
+
+            pool = VK_NULL_HANDLE;
+        }
+
         vmaDestroyAllocator(s_Allocator);
         s_Allocator = VK_NULL_HANDLE;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Frame
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanAllocator::NextFrame()
+    {
+        LU_PROFILE("VkAllocator::NextFrame()");
+
+        LU_ASSERT(s_Allocator, "[VkAllocator] Allocator not initialized.");
+
+        vmaSetCurrentFrameIndex(s_Allocator, ++s_FrameIndex);
+
+        #if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING
+        // Note: Tracy identifies plots by their name pointer, so the names need to outlive the plots
+        static const auto s_HeapNames = []()
+        {
+            Array<std::array<std::string, 2>, VK_MAX_MEMORY_HEAPS> names = { };
+            for (size_t i = 0; i < names.size(); i++)
+                names[i] = { std::format("VRAM: Heap {0} usage", i), std::format("VRAM: Heap {0} budget", i) };
+
+            return names;
+        }();
+        constexpr auto categoryNames = std::to_array<const char*>({ "VRAM: Images", "VRAM: Staging", "VRAM: Buffers" });
+
+        VulkanMemoryTelemetry telemetry = GetTelemetry();
+        for (uint32_t i = 0; i < telemetry.HeapCount; i++)
+        {
+            LU_PROFILE_PLOT(s_HeapNames[i][0].c_str(), static_cast<int64_t>(telemetry.Heaps[i].Usage));
+            LU_PROFILE_PLOT(s_HeapNames[i][1].c_str(), static_cast<int64_t>(telemetry.Heaps[i].Budget));
+        }
+
+        for (size_t i = 0; i < categoryNames.size(); i++)
+            LU_PROFILE_PLOT(categoryNames[i], static_cast<int64_t>(telemetry.CategoryBytes[i]));
+        #endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Telemetry
+    ////////////////////////////////////////////////////////////////////////////////////
+    VulkanMemoryTelemetry VulkanAllocator::GetTelemetry()
+    {
+        LU_PROFILE("VkAllocator::GetTelemetry()");
+
+        LU_ASSERT(s_Allocator, "[VkAllocator] Allocator not initialized.");
+
+        const VkPhysicalDeviceMemoryProperties* memoryProperties = nullptr;
+        vmaGetMemoryProperties(s_Allocator, &memoryProperties);
+
+        Array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets = { };
+        vmaGetHeapBudgets(s_Allocator, budgets.data());
+
+        VulkanMemoryTelemetry telemetry = {};
+        telemetry.HeapCount = memoryProperties->memoryHeapCount;
+        telemetry.BudgetExtension = s_BudgetExtension;
+
+        for (uint32_t i = 0; i < telemetry.HeapCount; i++)
+        {
+            VulkanHeapTelemetry& heap = telemetry.Heaps[i];
+            heap.Usage = budgets[i].usage;
+            heap.Budget = budgets[i].budget;
+            heap.BlockBytes = budgets[i].statistics.blockBytes;
+            heap.AllocationBytes = budgets[i].statistics.allocationBytes;
+            heap.BlockCount = budgets[i].statistics.blockCount;
+            heap.AllocationCount = budgets[i].statistics.allocationCount;
+            heap.DeviceLocal = (memoryProperties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT);
+        }
+
+        for (size_t i = 0; i < static_cast<size_t>(MemoryCategory::COUNT); i++)
+        {
+            telemetry.CategoryBytes[i] = s_CategoryBytes[i].load(std::memory_order_relaxed);
+            telemetry.CategoryAllocations[i] = s_CategoryAllocations[i].load(std::memory_order_relaxed);
+        }
+
+        for (size_t i = 0; i < s_Pools.size(); i++)
+        {
+            if (s_Pools[i] == VK_NULL_HANDLE)
+                continue;
+
+            VmaStatistics statistics = {};
+            vmaGetPoolStatistics(s_Allocator, s_Pools[i], &statistics);
+
+            telemetry.Pools[i].BlockBytes = statistics.blockBytes;
+            telemetry.Pools[i].AllocationBytes = statistics.allocationBytes;
+            telemetry.Pools[i].BlockCount = statistics.blockCount;
+            telemetry.Pools[i].AllocationCount = statistics.allocationCount;
+        }
+
+        return telemetry;
+    }
+
+    VmaTotalStatistics VulkanAllocator::CalculateStatistics()
+    {
+        LU_PROFILE("VkAllocator::CalculateStatistics()");
+
+        LU_ASSERT(s_Allocator, "[VkAllocator] Allocator not initialized.");
+
+        VmaTotalStatistics statistics = {};
+        vmaCalculateStatistics(s_Allocator, &statistics);
+
+        return statistics;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Pipeline Cache
     ////////////////////////////////////////////////////////////////////////////////////
@@ -101,7 +217,7 @@ namespace Lumen::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Buffer
     ////////////////////////////////////////////////////////////////////////////////////
-    VmaAllocation VulkanAllocator::AllocateBuffer(VmaMemoryUsage memoryUsage, VkBuffer& dstBuffer, size_t size, VkBufferUsageFlags usage, VkMemoryPropertyFlags requiredFlags)
+    VmaAllocation VulkanAllocator::AllocateBuffer(VmaMemoryUsage memoryUsage, VkBuffer& dstBuffer, size_t size, VkBufferUsageFlags usage, VkMemoryPropertyFlags requiredFlags, MemoryCategory category, AllocationPolicy policy)
     {
         LU_PROFILE("VkAllocator::AllocateBuffer()");
 
@@ -117,10 +233,31 @@ namespace Lumen::Internal
         VmaAllocationCreateInfo allocInfo = {};
         allocInfo.usage = memoryUsage; 
         allocInfo.requiredFlags = requiredFlags;
+        allocInfo.pUserData = reinterpret_cast<void*>(static_cast<uintptr_t>(category)); // Note: Used for per category telemetry
+
+        if (policy == AllocationPolicy::Auto)
+            policy = ((category == MemoryCategory::Staging) ? AllocationPolicy::Staging : AllocationPolicy::Default);
 
         VmaAllocation allocation = VK_NULL_HANDLE;
+
+        // Pooled
+        if (VmaPool pool = GetVmaPool(policy); pool != VK_NULL_HANDLE)
+        {
+            allocInfo.pool = pool;
+            if (vmaCreateBuffer(s_Allocator, &bufferInfo, &allocInfo, &dstBuffer, &allocation, nullptr) == VK_SUCCESS) [[likely]]
+            {
+                Track(allocation);
+                return allocation;
+            }
+
+            if (!s_FallbackReported[static_cast<size_t>(policy)].test_and_set(std::memory_order_relaxed)) [[unlikely]]
+                LU_LOG_WARN("[VkAllocator] Failed to allocate buffer of {0} bytes from the {1} pool, falling back to the default pools. Later fallbacks from this pool are not reported.", size, ::Lumen::Enum::Name(policy));
+            allocInfo.pool = VK_NULL_HANDLE;
+        }
+
         VK_VERIFY(vmaCreateBuffer(s_Allocator, &bufferInfo, &allocInfo, &dstBuffer, &allocation, nullptr));
 
+        Track(allocation);
         return allocation;
     }
 
@@ -147,44 +284,77 @@ namespace Lumen::Internal
 		LU_ASSERT((buffer != VK_NULL_HANDLE), "[VkAllocator] Invalid buffer passed in.");
 		LU_ASSERT((allocation != VK_NULL_HANDLE), "[VkAllocator] Invalid allocation passed in.");
 
+        Untrack(allocation);
         vmaDestroyBuffer(s_Allocator, buffer, allocation);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
     // Image
     ////////////////////////////////////////////////////////////////////////////////////
-    VmaAllocation VulkanAllocator::AllocateImage(VmaMemoryUsage memUsage, VkImage& image, uint32_t width, uint32_t height, uint32_t mipLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags requiredFlags)
+    VmaAllocation VulkanAllocator::AllocateImage(VmaMemoryUsage memUsage, VkImage& image, uint32_t width, uint32_t height, uint32_t mipLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags requiredFlags, AllocationPolicy policy)
     {
         LU_PROFILE("VkAllocator::AllocateImage()");
 
 		LU_ASSERT(s_Allocator, "[VkAllocator] Allocator not initialized.");
 		LU_ASSERT((width > 0) && (height > 0), "[VkAllocator] Invalid width or height passed in for image allocation.");
 
-        VkImageCreateInfo imageInfo = {};
-        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-        imageInfo.imageType = VK_IMAGE_TYPE_2D;
-        imageInfo.extent.width = width;
-        imageInfo.extent.height = height;
-        imageInfo.extent.depth = 1;
-        imageInfo.mipLevels = mipLevels;
-        imageInfo.arrayLayers = 1;
-        imageInfo.format = format;
-        imageInfo.tiling = tiling;
-        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        imageInfo.usage = usage;
-		imageInfo.samples = VK_SAMPLE_COUNT_1_BIT; // Note/TODO: This should maybe be made a parameter
-        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE; // Note: On most modern system all queue family indices are the same for graphics & compute, so we can use exclusive sharing mode between these queue's (since they are the same). If you need to use different queue families, then you need to use concurrent sharing mode and specify the queue family indices in the pQueueFamilyIndices field.
+        VkImageCreateInfo imageInfo = GetImageCreateInfo(width, height, mipLevels, format, tiling, usage);
 
         VmaAllocationCreateInfo allocCreateInfo = {};
         allocCreateInfo.usage = memUsage;
         allocCreateInfo.requiredFlags = requiredFlags;
+        allocCreateInfo.pUserData = reinterpret_cast<void*>(static_cast<uintptr_t>(MemoryCategory::Images)); // Note: Used for per category telemetry
+
+        if (policy == AllocationPolicy::Auto)
+        {
+            size_t pixelSize = ((VkFormatToPixelSize(format) != 0) ? VkFormatToPixelSize(format) : 16); // Note: Unknown formats are assumed to be large
+            size_t estimatedSize = static_cast<size_t>(width) * height * pixelSize;
+            if (mipLevels > 1)
+                estimatedSize += estimatedSize / 3;
+
+            bool small = ((tiling == VK_IMAGE_TILING_OPTIMAL) && (estimatedSize <= SmallImageThreshold));
+            policy = (small ? AllocationPolicy::SmallImage : AllocationPolicy::Default);
+        }
 
         VmaAllocation allocation = VK_NULL_HANDLE;
+
+        // Pooled // Note: Fails if the image's memory requirements don't allow the pool's memory type
+        if (VmaPool pool = GetVmaPool(policy); pool != VK_NULL_HANDLE)
+        {
+            allocCreateInfo.pool = pool;
+            if (vmaCreateImage(s_Allocator, &imageInfo, &allocCreateInfo, &image, &allocation, nullptr) == VK_SUCCESS) [[likely]]
+            {
+                Track(allocation);
+                return allocation;
+            }
+
+            if (!s_FallbackReported[static_cast<size_t>(policy)].test_and_set(std::memory_order_relaxed)) [[unlikely]]
+                LU_LOG_WARN("[VkAllocator] Failed to allocate image of {0}x{1} from the {2} pool, falling back to the default pools. Later fallbacks from this pool are not reported.", width, height, ::Lumen::Enum::Name(policy));
+            allocCreateInfo.pool = VK_NULL_HANDLE;
+        }
+
         VK_VERIFY(vmaCreateImage(s_Allocator, &imageInfo, &allocCreateInfo, &image, &allocation, nullptr));
 
+        Track(allocation);
         return allocation;
     }
 
+    VkImage VulkanAllocator::CreateBoundImage(VmaAllocation allocation, uint32_t width, uint32_t height, uint32_t mipLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage)
+    {
+        LU_PROFILE("VkAllocator::CreateBoundImage()");
+
+		LU_ASSERT(s_Allocator, "[VkAllocator] Allocator not initialized.");
+		LU_ASSERT((allocation != VK_NULL_HANDLE), "[VkAllocator] Invalid allocation passed in.");
+
+        VkImageCreateInfo imageInfo = GetImageCreateInfo(width, height, mipLevels, format, tiling, usage);
+
+        VkImage image = VK_NULL_HANDLE;
+        VK_VERIFY(vkCreateImage(VulkanContext::GetVulkanDevice().GetVkDevice(), &imageInfo, nullptr, &image));
+        VK_VERIFY(vmaBindImageMemory(s_Allocator, allocation, image));
+
+        return image;
+    }
+
     void VulkanAllocator::CopyBufferToImage(VkCommandBuffer cmdBuf, VkBuffer& buffer, VkImage& image, uint32_t width, uint32_t height)
     {
         LU_PROFILE("VkAllocator::CopyBufferToImage()");
@@ -272,6 +442,7 @@ namespace Lumen::Internal
 		LU_ASSERT((image != VK_NULL_HANDLE), "[VkAllocator] Invalid image passed in.");
 		LU_ASSERT((allocation != VK_NULL_HANDLE), "[VkAllocator] Invalid allocation passed in.");
 
+        Untrack(allocation);
         vmaDestroyImage(s_Allocator, image, allocation);
     }
 
@@ -298,6 +469,16 @@ namespace Lumen::Internal
         vmaUnmapMemory(s_Allocator, allocation);
     }
 
+    void VulkanAllocator::InvalidateMemory(VmaAllocation& allocation, size_t size, size_t offset)
+    {
+        LU_PROFILE("VkAllocator::InvalidateMemory()");
+
+        LU_ASSERT(s_Allocator, "[VkAllocator] Allocator not initialized.");
+		LU_ASSERT((allocation != VK_NULL_HANDLE), "[VkAllocator] Invalid allocation passed in.");
+
+        VK_VERIFY(vmaInvalidateAllocation(s_Allocator, allocation, static_cast<VkDeviceSize>(offset), static_cast<VkDeviceSize>(size)));
+    }
+
     void VulkanAllocator::SetData(VmaAllocation& allocation, void* data, size_t size)
     {
         LU_PROFILE("VkAllocator::SetData()");
@@ -324,4 +505,87 @@ namespace Lumen::Internal
 		std::memcpy(mappedData, data, size);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Internal getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    VmaPool VulkanAllocator::GetVmaPool(AllocationPolicy policy)
+    {
+        return s_Pools[static_cast<size_t>(policy)];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanAllocator::Track(VmaAllocation allocation)
+    {
+        if (allocation == VK_NULL_HANDLE) [[unlikely]]
+            return;
+
+        VmaAllocationInfo info = {};
+        vmaGetAllocationInfo(s_Allocator, allocation, &info);
+
+        size_t category = static_cast<size_t>(reinterpret_cast<uintptr_t>(info.pUserData));
+        s_CategoryBytes[category].fetch_add(info.size, std::memory_order_relaxed);
+        s_CategoryAllocations[category].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void VulkanAllocator::Untrack(VmaAllocation allocation)
+    {
+        VmaAllocationInfo info = {};
+        vmaGetAllocationInfo(s_Allocator, allocation, &info);
+
+        size_t category = static_cast<size_t>(reinterpret_cast<uintptr_t>(info.pUserData));
+        s_CategoryBytes[category].fetch_sub(info.size, std::memory_order_relaxed);
+        s_CategoryAllocations[category].fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Init methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanAllocator::InitPools()
+    {
+        // Staging
+        {
+            VkBufferCreateInfo bufferInfo = {};
+            bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            bufferInfo.size = 1024; // Note: Only used to find a memory type
+            bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+
+            VmaAllocationCreateInfo allocInfo = {};
+            allocInfo.usage = VMA_MEMORY_USAGE_CPU_ONLY;
+            allocInfo.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+            VmaPoolCreateInfo poolInfo = {};
+            VK_VERIFY(vmaFindMemoryTypeIndexForBufferInfo(s_Allocator, &bufferInfo, &allocInfo, &poolInfo.memoryTypeIndex));
+            poolInfo.blockSize = StagingBlockSize;
+
+            VK_VERIFY(vmaCreatePool(s_Allocator, &poolInfo, &s_Pools[static_cast<size_t>(AllocationPolicy::Staging)]));
+        }
+
+        // Small images
+        {
+            VkImageCreateInfo imageInfo = {};
+            imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+            imageInfo.imageType = VK_IMAGE_TYPE_2D;
+            imageInfo.extent = { 64, 64, 1 }; // Note: Only used to find a memory type
+            imageInfo.mipLevels = 1;
+            imageInfo.arrayLayers = 1;
+            imageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+            imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+            imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+            imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+            imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+            VmaAllocationCreateInfo allocInfo = {};
+            allocInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+
+            VmaPoolCreateInfo poolInfo = {};
+            VK_VERIFY(vmaFindMemoryTypeIndexForImageInfo(s_Allocator, &imageInfo, &allocInfo, &poolInfo.memoryTypeIndex));
+            poolInfo.blockSize = SmallImageBlockSize;
+
+            VK_VERIFY(vmaCreatePool(s_Allocator, &poolInfo, &s_Pools[static_cast<size_t>(AllocationPolicy::SmallImage)]));
+        }
+    }
+
 }
\ No newline at end of file
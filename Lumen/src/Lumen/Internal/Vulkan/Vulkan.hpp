@@ -4,10 +4,13 @@
 #include "Lumen/Internal/Utils/Settings.hpp"
 #include "Lumen/Internal/Utils/Preprocessor.hpp"
 
+#include "Lumen/Internal/Memory/Array.hpp"
+
 #include "Lumen/Enum/Name.hpp"
 
 #include <cstdint>
 #include <utility>
+#include <atomic>
 #include <array>
 #include <tuple>
 #include <span>
@@ -61,27 +64,95 @@ namespace Lumen::Internal
         #define VK_VERIFY(expr) expr
     #endif
 
+    ////////////////////////////////////////////////////////////////////////////////////
+	// Allocation policy
+    ////////////////////////////////////////////////////////////////////////////////////
+    enum class AllocationPolicy : uint8_t
+    {
+        Auto = 0,       // Picks a pool based on the memory category and size
+        Default,        // VMA's default pools
+        Staging,        // Host visible & coherent pool for staging buffers
+        SmallImage,     // Block pool for optimal tiled images below SmallImageThreshold
+
+        COUNT
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+	// Memory telemetry
+    ////////////////////////////////////////////////////////////////////////////////////
+    enum class MemoryCategory : uint8_t { Images = 0, Staging, Buffers, COUNT };
+
+    struct VulkanPoolTelemetry
+    {
+    public:
+        uint64_t BlockBytes = 0;
+        uint64_t AllocationBytes = 0;
+        uint32_t BlockCount = 0;
+        uint32_t AllocationCount = 0;
+    };
+
+    struct VulkanHeapTelemetry
+    {
+    public:
+        uint64_t Usage = 0;             // Note: Reported by the driver when VK_EXT_memory_budget is enabled, otherwise an estimate from VMA
+        uint64_t Budget = 0;            // Note: How much the process can use before allocations start failing or getting evicted
+
+        uint64_t BlockBytes = 0;        // Bytes of VkDeviceMemory allocated by VMA
+        uint64_t AllocationBytes = 0;   // Bytes of live VMA allocations inside those blocks
+        uint32_t BlockCount = 0;
+        uint32_t AllocationCount = 0;
+
+        bool DeviceLocal = false;
+    };
+
+    struct VulkanMemoryTelemetry
+    {
+    public:
+        Array<VulkanHeapTelemetry, VK_MAX_MEMORY_HEAPS> Heaps = { };
+        uint32_t HeapCount = 0;
+
+        Array<uint64_t, static_cast<size_t>(MemoryCategory::COUNT)> CategoryBytes = { };
+        Array<uint32_t, static_cast<size_t>(MemoryCategory::COUNT)> CategoryAllocations = { };
+
+        Array<VulkanPoolTelemetry, static_cast<size_t>(AllocationPolicy::COUNT)> Pools = { }; // Note: Only the pooled policies (Staging & SmallImage) are filled in
+
+        bool BudgetExtension = false;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
 	// VulkanAllocator
     ////////////////////////////////////////////////////////////////////////////////////
     class VulkanAllocator
     {
+    public:
+        // Settings
+        inline constexpr static const size_t StagingBlockSize = 64ull * 1024 * 1024;
+        inline constexpr static const size_t SmallImageBlockSize = 32ull * 1024 * 1024;
+        inline constexpr static const size_t SmallImageThreshold = 1ull * 1024 * 1024; // Note: Estimated from the image's dimensions & format
     public:
         // Init & Destroy
         static void Init();
         static void Destroy();
 
+        // Frame
+        static void NextFrame(); // Note: Refreshes VMA's cached budget and plots the telemetry to the profiler
+
+        // Telemetry
+        static VulkanMemoryTelemetry GetTelemetry(); // Note: Cheap, safe to call every frame
+        static VmaTotalStatistics CalculateStatistics(); // Note: Walks every block, only use this for detailed reports
+
         // Pipeline Cache
         static VkPipelineCache CreatePipelineCache(std::span<const uint8_t> data);
 		inline static VkPipelineCache GetPipelineCache() { return s_PipelineCache; }
 
         // Buffer
-        static VmaAllocation AllocateBuffer(VmaMemoryUsage memoryUsage, VkBuffer& dstBuffer, size_t size, VkBufferUsageFlags usage, VkMemoryPropertyFlags requiredFlags = 0);
+        static VmaAllocation AllocateBuffer(VmaMemoryUsage memoryUsage, VkBuffer& dstBuffer, size_t size, VkBufferUsageFlags usage, VkMemoryPropertyFlags requiredFlags = 0, MemoryCategory category = MemoryCategory::Buffers, AllocationPolicy policy = AllocationPolicy::Auto); // Note: Pooled allocations ignore memoryUsage, since the pool decides the memory type
         static void CopyBuffer(VkCommandBuffer cmdBuf, VkBuffer& srcBuffer, VkBuffer& dstBuffer, size_t size, size_t offset = 0);
         static void DestroyBuffer(VkBuffer buffer, VmaAllocation allocation);
 
         // Image
-        static VmaAllocation AllocateImage(VmaMemoryUsage memUsage, VkImage& image, uint32_t width, uint32_t height, uint32_t mipLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags requiredFlags = 0);
+        static VmaAllocation AllocateImage(VmaMemoryUsage memUsage, VkImage& image, uint32_t width, uint32_t height, uint32_t mipLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags requiredFlags = 0, AllocationPolicy policy = AllocationPolicy::Auto);
+        static VkImage CreateBoundImage(VmaAllocation allocation, uint32_t width, uint32_t height, uint32_t mipLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage); // Note: Creates an image on top of existing memory, used for defragmentation
 		static void CopyBufferToImage(VkCommandBuffer cmdBuf, VkBuffer& buffer, VkImage& image, uint32_t width, uint32_t height); // Note: The image will be in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL after the copy
         static VkImageView CreateImageView(VkImage& image, VkFormat format, VkImageAspectFlags aspectFlags, uint32_t mipLevels);
         static VkSampler CreateSampler(VkFilter magFilter, VkFilter minFilter, VkSamplerAddressMode addressmode, VkSamplerMipmapMode mipmapMode, uint32_t mipLevels);
@@ -90,12 +161,35 @@ namespace Lumen::Internal
         // Utils
         static void MapMemory(VmaAllocation& allocation, void*& mapData);
         static void UnMapMemory(VmaAllocation& allocation);
+        static void InvalidateMemory(VmaAllocation& allocation, size_t size, size_t offset = 0); // Note: Required before reading GPU written data from non-coherent memory
         static void SetData(VmaAllocation& allocation, void* data, size_t size);
         static void SetMappedData(void* mappedData, void* data, size_t size);
 
+        // Internal
+        static void Track(VmaAllocation allocation);
+        static void Untrack(VmaAllocation allocation); // Note: Must be called for allocations that are freed outside of DestroyBuffer/DestroyImage
+
+        // Internal getters
+        static VmaPool GetVmaPool(AllocationPolicy policy); // Note: Returns VK_NULL_HANDLE for non-pooled policies
+        inline static VmaAllocator GetVmaAllocator() { return s_Allocator; }
+
+    private:
+        // Init methods
+        static void InitPools();
+
     private:
 		inline static VmaAllocator s_Allocator = VK_NULL_HANDLE;
 		inline static VkPipelineCache s_PipelineCache = VK_NULL_HANDLE;
+
+        inline static Array<VmaPool, static_cast<size_t>(AllocationPolicy::COUNT)> s_Pools = { };
+
+        inline static uint32_t s_FrameIndex = 0;
+        inline static bool s_BudgetExtension = false;
+
+        inline static Array<std::atomic<uint64_t>, static_cast<size_t>(MemoryCategory::COUNT)> s_CategoryBytes = { };
+        inline static Array<std::atomic<uint32_t>, static_cast<size_t>(MemoryCategory::COUNT)> s_CategoryAllocations = { };
+
+        inline static Array<std::atomic_flag, static_cast<size_t>(AllocationPolicy::COUNT)> s_FallbackReported = { }; // Note: Pool fallbacks are only logged once per policy, since they can happen every frame
     };
 
 }
\ No newline at end of file
@@ -16,17 +16,13 @@ namespace Lumen::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	void VulkanStagingBufferRegistry::RetireUsed()
 	{
-		uint32_t frame = 0; //VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame(); // TODO: Replace all frame instances
-
-		for (auto& buffer : m_InUse[frame])
-		{
-			size_t bitsNeeded = std::bit_width(buffer.Size);
-			size_t index = bitsNeeded - 1;
-		
-			m_Buffers[frame][index].emplace(buffer);
-		}
+		Retire(VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame());
+	}
 
-		m_InUse[frame].clear();
+	void VulkanStagingBufferRegistry::RetireAll()
+	{
+		for (uint32_t i = 0; i < RendererSpecification::MaxFramesInFlight; i++)
+			Retire(i);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -36,7 +32,7 @@ namespace Lumen::Internal
 	{
 		LU_ASSERT((size != 0), "[VkStagingBufferRegistry] Invalid size passed in.");
 
-		uint32_t frame = 0; //VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame(); // TODO: Replace all frame instances
+		uint32_t frame = VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame();
 		size_t bitsNeeded = std::bit_width(size);
 		size_t index = bitsNeeded - 1;
 
@@ -56,13 +52,25 @@ namespace Lumen::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	// Private methods
 	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanStagingBufferRegistry::Retire(uint32_t frame)
+	{
+		for (auto& buffer : m_InUse[frame])
+		{
+			size_t index = std::bit_width(buffer.Size - 1) - 1; // Note: Buffer sizes are powers of 2 that fit bit_width(size) bits
+		
+			m_Buffers[frame][index].emplace(buffer);
+		}
+
+		m_InUse[frame].clear();
+	}
+
 	VulkanStagingBuffer& VulkanStagingBufferRegistry::CreateBuffer(size_t bitsNeeded)
 	{
-		uint32_t frame = 0; //VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame(); // TODO: Replace all frame instances
-		size_t bufferSize = std::bit_ceil(bitsNeeded);
+		uint32_t frame = VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame();
+		size_t bufferSize = (static_cast<size_t>(1) << bitsNeeded);
 
 		VkBuffer buffer = VK_NULL_HANDLE;
-		VmaAllocation allocation = VulkanAllocator::AllocateBuffer(VMA_MEMORY_USAGE_CPU_ONLY, buffer, bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+		VmaAllocation allocation = VulkanAllocator::AllocateBuffer(VMA_MEMORY_USAGE_CPU_ONLY, buffer, bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, MemoryCategory::Staging);
 
 		void* mappedData = nullptr;
 		VulkanAllocator::MapMemory(allocation, mappedData);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Lumen/Internal/Utils/Profiler.hpp"
+#include "Lumen/Internal/Utils/FrameStatistics.hpp"
 #include "Lumen/Internal/Memory/Array.hpp"
 
 #include "Lumen/Internal/Renderer/RendererSpec.hpp"
@@ -48,6 +49,7 @@ namespace Lumen::Internal
 
         // Methods
         void RetireUsed();
+        void RetireAll(); // Note: Only safe when no frame is in flight
 
         // Getters
         VulkanStagingBuffer& GetBuffer(size_t size);
@@ -55,14 +57,15 @@ namespace Lumen::Internal
     private:
         // Private methods
         VulkanStagingBuffer& CreateBuffer(size_t bitsNeeded);
+        void Retire(uint32_t frame);
 
         void DestroyBuffers(std::queue<VulkanStagingBuffer>& buffers);
         void DestroyBuffers(std::vector<VulkanStagingBuffer>& buffers);
 
     public:
         // Ascending in size and indexed by bits necessary to fit the size (std::bit_width) - 1
-        Array<Array<std::queue<VulkanStagingBuffer>, 35>, RendererSpecification::FramesInFlight> m_Buffers = { };
-        Array<std::vector<VulkanStagingBuffer>, RendererSpecification::FramesInFlight> m_InUse = { };
+        Array<Array<std::queue<VulkanStagingBuffer>, 35>, RendererSpecification::MaxFramesInFlight> m_Buffers = { };
+        Array<std::vector<VulkanStagingBuffer>, RendererSpecification::MaxFramesInFlight> m_InUse = { };
     };
 
 }
@@ -22,6 +22,8 @@ namespace Lumen::Internal
     {
         LU_PROFILE("VkStagingBuffer::SetData()");
         memcpy(Mapped, data, size);
+
+        FrameStatistics::AddStagingBytes(size);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -35,7 +37,7 @@ namespace Lumen::Internal
                 DestroyBuffers(buffers);
         }
 
-        for (size_t i = 0; i < RendererSpecification::FramesInFlight; i++)
+        for (size_t i = 0; i < RendererSpecification::MaxFramesInFlight; i++)
             DestroyBuffers(m_InUse[i]);
     }
 
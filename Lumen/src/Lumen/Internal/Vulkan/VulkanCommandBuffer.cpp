@@ -8,6 +8,8 @@
 #include "Lumen/Internal/Vulkan/VulkanContext.hpp"
 #include "Lumen/Internal/Vulkan/VulkanRenderer.hpp"
 
+#include <cstring>
+
 namespace Lumen::Internal
 {
 
@@ -25,13 +27,33 @@ namespace Lumen::Internal
         allocInfo.commandBufferCount = 1;
 
         VK_VERIFY(vkAllocateCommandBuffers(device, &allocInfo, &m_CommandBuffer));
+        m_Handle = s_Pool.Create(m_CommandBuffer);
     }
 
     VulkanCommandBuffer::~VulkanCommandBuffer()
     {
+        s_Pool.Destroy(m_Handle);
         VulkanRenderer::GetRenderer().GetGarbageCollector().Collect(m_CommandBuffer);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Internal
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanCommandBuffer::BeginZone([[maybe_unused]] const char* name)
+    {
+        #if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING
+        // Note: A transient zone, since the name is only known at runtime
+        m_Zone.Construct(VulkanProfiler::GetContext(), static_cast<uint32_t>(__LINE__), __FILE__, std::strlen(__FILE__), __FUNCTION__, std::strlen(__FUNCTION__), name, std::strlen(name), m_CommandBuffer, true);
+        #endif
+    }
+
+    void VulkanCommandBuffer::EndZone()
+    {
+        #if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING
+        m_Zone.Destroy(); // Note: Writes the end timestamp
+        #endif
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
 	// Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
@@ -39,7 +61,7 @@ namespace Lumen::Internal
     {
         VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
 
-        Array<VkCommandBuffer, RendererSpecification::FramesInFlight> temp = {};
+        Array<VkCommandBuffer, RendererSpecification::MaxFramesInFlight> temp = {}; // Note: Allocated for the maximum, so the amount of frames in flight can change at runtime
 
         VkCommandBufferAllocateInfo allocInfo = {};
         allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -61,16 +83,14 @@ namespace Lumen::Internal
     ////////////////////////////////////////////////////////////////////////////////////
 	// Getters
     ////////////////////////////////////////////////////////////////////////////////////
-    VkCommandBuffer VulkanRenderCommandBuffer::GetVkCommandBuffer() const // TODO: ...
+    VkCommandBuffer VulkanRenderCommandBuffer::GetVkCommandBuffer() const
     {
-        //return GetVkCommandBuffer(VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame());
-        return VK_NULL_HANDLE;
+        return GetVkCommandBuffer(VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame());
     }
 
     VulkanCommandBuffer& VulkanRenderCommandBuffer::GetCommandBuffer()
     {
-        //return GetCommandBuffer(VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame());
-        return *static_cast<VulkanCommandBuffer*>(nullptr);
+        return GetCommandBuffer(VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame());
     }
 
 }
\ No newline at end of file
@@ -2,16 +2,28 @@
 
 #include "Lumen/Internal/Memory/Array.hpp"
 #include "Lumen/Internal/Memory/DeferredConstruct.hpp"
+#include "Lumen/Internal/Memory/HandlePool.hpp"
 
 #include "Lumen/Internal/Renderer/RendererSpec.hpp"
 
 #include "Lumen/Internal/Vulkan/Vulkan.hpp"
+#include "Lumen/Internal/Vulkan/VulkanProfiler.hpp"
 
 #include "Lumen/Core/Core.hpp"
 
 namespace Lumen::Internal
 {
 
+    class CommandBuffer;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Handles
+    ////////////////////////////////////////////////////////////////////////////////////
+    enum class CommandBufferColumn : uint8_t { CommandBuffer = 0 };
+
+    using CommandBufferHandle = Handle<CommandBuffer>;
+    using VulkanCommandBufferPool = HandlePool<CommandBuffer, VkCommandBuffer>;
+
     ////////////////////////////////////////////////////////////////////////////////////
     // VulkanCommandBuffer
     ////////////////////////////////////////////////////////////////////////////////////
@@ -25,11 +37,26 @@ namespace Lumen::Internal
 
         // The Begin, End & Submit methods are in the Renderer class.
 
+        // Internal
+        void BeginZone(const char* name); // Note: Opens the GPU zone of the recorded commands, does nothing if profiling is disabled
+        void EndZone();
+
         // Getters
         forceinline VkCommandBuffer GetVkCommandBuffer() const { return m_CommandBuffer; }
+        forceinline CommandBufferHandle GetHandle() const { return m_Handle; }
+
+        // Static methods
+        forceinline static VulkanCommandBufferPool& GetPool() { return s_Pool; } // Note: Resolves the handles stored in frame graphs
 
     private:
         VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
+        CommandBufferHandle m_Handle = {};
+
+        #if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING
+        DeferredConstruct<tracy::VkCtxScope, true> m_Zone = {};
+        #endif
+
+        inline static VulkanCommandBufferPool s_Pool = {};
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -51,7 +78,7 @@ namespace Lumen::Internal
         forceinline VulkanCommandBuffer& GetCommandBuffer(uint32_t index) { return m_CommandBuffers[index]; }
 
     private:
-        Array<DeferredConstruct<VulkanCommandBuffer>, RendererSpecification::FramesInFlight> m_CommandBuffers = {};
+        Array<DeferredConstruct<VulkanCommandBuffer>, RendererSpecification::MaxFramesInFlight> m_CommandBuffers = {};
     };
 
 }
@@ -5,7 +5,7 @@ namespace Lumen::Internal
 	// Constructors & Destructors
 	////////////////////////////////////////////////////////////////////////////////////
 	forceinline VulkanCommandBuffer::VulkanCommandBuffer(VkCommandBuffer commandBuffer)
-		: m_CommandBuffer(commandBuffer)
+		: m_CommandBuffer(commandBuffer), m_Handle(s_Pool.Create(commandBuffer))
 	{
 	}
 
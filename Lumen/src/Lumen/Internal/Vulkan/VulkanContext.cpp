@@ -6,6 +6,8 @@
 
 #include "Lumen/Internal/Renderer/GraphicsContext.hpp"
 
+#include "Lumen/Internal/Vulkan/VulkanHostAllocator.hpp"
+
 #if defined(LU_PLATFORM_DESKTOP)
     #define GLFW_INCLUDE_VULKAN
     #include <GLFW/glfw3.h>
@@ -125,7 +127,7 @@ namespace Lumen::Internal
                 DestroyDebugUtilsMessengerEXT(m_Instance, m_DebugMessenger, nullptr);
         }
 
-        vkDestroyInstance(m_Instance, nullptr);
+        vkDestroyInstance(m_Instance, VulkanHostAllocator::GetCallbacks());
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -244,7 +246,7 @@ namespace Lumen::Internal
 			createInfo.pNext = nullptr;
 		}
 
-		VK_VERIFY(vkCreateInstance(&createInfo, nullptr, &m_Instance));
+		VK_VERIFY(vkCreateInstance(&createInfo, VulkanHostAllocator::GetCallbacks(), &m_Instance));
 
 		///////////////////////////////////////////////////////////
 		// Debugger Creation
@@ -31,6 +31,10 @@ namespace Lumen::Internal
             "VK_KHR_portability_subset"
             #endif
         });
+        inline constexpr static auto OptionalDeviceExtensions = std::to_array<const char*>({ // Note: Enabled when the physical device supports them
+            VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+            VK_KHR_PRESENT_ID_EXTENSION_NAME, VK_KHR_PRESENT_WAIT_EXTENSION_NAME
+        });
     public:
         // Constructors & Destructor
         VulkanContext() = default;
@@ -0,0 +1,364 @@
+#include "lupch.h"
+#include "VulkanDefragmenter.hpp"
+
+#include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Utils/Profiler.hpp"
+#include "Lumen/Internal/Utils/FrameStatistics.hpp"
+
+#include "Lumen/Internal/Renderer/RendererSpec.hpp"
+
+#include "Lumen/Internal/Vulkan/VulkanImage.hpp"
+#include "Lumen/Internal/Vulkan/VulkanContext.hpp"
+#include "Lumen/Internal/Vulkan/VulkanRenderer.hpp"
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Constructor & Destructor
+	////////////////////////////////////////////////////////////////////////////////////
+	VulkanDefragmenter::VulkanDefragmenter()
+		: m_Countdown(IdleFrames)
+	{
+		VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+		VkCommandPoolCreateInfo poolInfo = {};
+		poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+		poolInfo.queueFamilyIndex = VulkanContext::GetVulkanDevice().GetQueueFamily();
+
+		VK_VERIFY(vkCreateCommandPool(device, &poolInfo, nullptr, &m_CommandPool));
+
+		VkCommandBufferAllocateInfo allocInfo = {};
+		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		allocInfo.commandPool = m_CommandPool;
+		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		allocInfo.commandBufferCount = 1;
+
+		VK_VERIFY(vkAllocateCommandBuffers(device, &allocInfo, &m_CommandBuffer));
+
+		VkFenceCreateInfo fenceInfo = {};
+		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		fenceInfo.flags = 0;
+
+		VK_VERIFY(vkCreateFence(device, &fenceInfo, nullptr, &m_Fence));
+	}
+
+	VulkanDefragmenter::~VulkanDefragmenter()
+	{
+		VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+		if (m_State == State::Retiring)
+		{
+			VK_VERIFY(vkWaitForFences(device, 1, &m_Fence, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+
+			// Note: The garbage collector has already been disposed at this point, so we destroy the old handles ourselves
+			for (auto& relocation : m_Relocations)
+			{
+				vkDestroyImageView(device, relocation.OldImageView, nullptr);
+				vkDestroyImage(device, relocation.OldImage, nullptr);
+			}
+			m_Relocations.clear();
+
+			vmaEndDefragmentationPass(VulkanAllocator::GetVmaAllocator(), m_Context, &m_Pass);
+		}
+
+		// Note: The renderer is already gone at this point, so End doesn't reach it & the orphans are destroyed here as well
+		if (m_State != State::Idle)
+			End();
+
+		for (auto& orphan : m_Orphans)
+		{
+			if (orphan.Sampler)
+				vkDestroySampler(device, orphan.Sampler, nullptr);
+			if (orphan.ImageView)
+				vkDestroyImageView(device, orphan.ImageView, nullptr);
+
+			VulkanAllocator::DestroyImage(orphan.Image, orphan.Allocation);
+		}
+
+		vkDestroyFence(device, m_Fence, nullptr);
+
+		// Note: Also frees the command buffer allocated from it
+		vkDestroyCommandPool(device, m_CommandPool, nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanDefragmenter::Register(ImageHandle image)
+	{
+		std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+		m_Images[VulkanImage::GetPool().Get<ImageColumn::Allocation>(image)] = image;
+	}
+
+	bool VulkanDefragmenter::Unregister(ImageHandle image)
+	{
+		std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+		VulkanImagePool& pool = VulkanImage::GetPool();
+		VmaAllocation allocation = pool.Get<ImageColumn::Allocation>(image);
+		m_Images.Erase(allocation);
+
+		if (m_State == State::Idle)
+			return false;
+
+		// Note: The allocation may be the source of a move in this or a later pass of the run, so it can't be freed before the run ends.
+		//       A move that is in flight is still completed, afterwards the allocation owns the memory the pool's (new) image is bound to.
+		//       So the memory stays valid until the garbage collector retires the entry, while VMA's DESTROY/IGNORE would free it at the end of the pass.
+		m_Orphans.emplace_back(pool.Get<ImageColumn::Image>(image), allocation, pool.Get<ImageColumn::ImageView>(image), pool.Get<ImageColumn::Sampler>(image));
+		return true;
+	}
+
+	void VulkanDefragmenter::Step()
+	{
+		LU_PROFILE("VkDefragmenter::Step()");
+
+		// Note: Images are registered & unregistered from any thread, so the whole step is locked
+		std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+
+		switch (m_State)
+		{
+		case State::Idle:
+		{
+			if (m_Countdown > 0)
+			{
+				m_Countdown--;
+				return;
+			}
+			if (m_Images.Empty())
+				return;
+
+			Begin();
+			BeginPass();
+			break;
+		}
+		case State::Ready:
+		{
+			BeginPass();
+			break;
+		}
+		case State::Retiring:
+		{
+			// Note: Wait until every frame that could still reference the old images has finished
+			if (m_Countdown > 0)
+			{
+				m_Countdown--;
+				return;
+			}
+			if (vkGetFenceStatus(VulkanContext::GetVulkanDevice().GetVkDevice(), m_Fence) != VK_SUCCESS)
+				return;
+
+			EndPass();
+			break;
+		}
+
+		default:
+			LU_ASSERT(false, "[VkDefragmenter] Invalid state.");
+			break;
+		}
+
+		// Note: No pass references the orphans once the run has ended, so they retire like any other image
+		if ((m_State == State::Idle) && !m_Orphans.empty())
+		{
+			VulkanGarbageCollector& garbageCollector = VulkanRenderer::GetRenderer().GetGarbageCollector();
+			for (auto& orphan : m_Orphans)
+				garbageCollector.Collect(orphan);
+			m_Orphans.clear();
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanDefragmenter::Begin()
+	{
+		VmaDefragmentationInfo info = {};
+		info.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_BALANCED_BIT;
+		info.pool = ((m_Target == 0) ? VK_NULL_HANDLE : VulkanAllocator::GetVmaPool(AllocationPolicy::SmallImage)); // Note: VK_NULL_HANDLE means the default pools
+		info.maxBytesPerPass = static_cast<VkDeviceSize>(MaxBytesPerFrame);
+		info.maxAllocationsPerPass = MaxMovesPerFrame;
+
+		VK_VERIFY(vmaBeginDefragmentation(VulkanAllocator::GetVmaAllocator(), &info, &m_Context));
+
+		m_State = State::Ready;
+		m_Passes = 0;
+	}
+
+	void VulkanDefragmenter::End()
+	{
+		VmaDefragmentationStats stats = {};
+		vmaEndDefragmentation(VulkanAllocator::GetVmaAllocator(), m_Context, &stats);
+
+		if (stats.bytesMoved > 0)
+			LU_LOG_TRACE("[VkDefragmenter] Moved {0} bytes in {1} allocations, freed {2} bytes.", stats.bytesMoved, stats.allocationsMoved, stats.bytesFreed);
+
+
+		m_Context = VK_NULL_HANDLE;
+		m_State = State::Idle;
+		m_Countdown = IdleFrames;
+
+		// Alternate between the default pools and the small image pool
+		m_Target = (m_Target + 1) % 2;
+	}
+
+	void VulkanDefragmenter::BeginPass()
+	{
+		m_Passes++;
+
+		VkResult result = vmaBeginDefragmentationPass(VulkanAllocator::GetVmaAllocator(), m_Context, &m_Pass);
+		if (result == VK_SUCCESS) // Note: Nothing left to move
+		{
+			End();
+			return;
+		}
+
+		VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+		VK_VERIFY(vkResetFences(device, 1, &m_Fence));
+		VK_VERIFY(vkResetCommandBuffer(m_CommandBuffer, 0));
+
+		VkCommandBufferBeginInfo beginInfo = {};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+		VK_VERIFY(vkBeginCommandBuffer(m_CommandBuffer, &beginInfo));
+
+		{
+			LU_PROFILE_GPU(m_CommandBuffer, "VkDefragmenter::BeginPass()");
+
+			m_Relocations.reserve(m_Pass.moveCount);
+			for (uint32_t i = 0; i < m_Pass.moveCount; i++)
+			{
+				VmaDefragmentationMove& move = m_Pass.pMoves[i];
+
+				// Note: Buffers, staging memory and swapchain images are not tracked, so they stay where they are
+				ImageHandle* image = m_Images.Find(move.srcAllocation);
+				if (!image || !VulkanImage::GetPool().IsValid(*image))
+				{
+					move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+					continue;
+				}
+
+				Relocate(*image, move, m_CommandBuffer);
+			}
+		}
+
+		VK_VERIFY(vkEndCommandBuffer(m_CommandBuffer));
+
+		VkSubmitInfo submitInfo = {};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &m_CommandBuffer;
+
+		// Note: Submitted before the frame's own work, so new frames see the copied contents
+		VK_VERIFY(vkQueueSubmit(VulkanContext::GetVulkanDevice().GetGraphicsQueue(), 1, &submitInfo, m_Fence));
+		FrameStatistics::AddSubmits();
+
+		m_State = State::Retiring;
+		m_Countdown = VulkanRenderer::GetRenderer().GetSpecification().FramesInFlight;
+	}
+
+	void VulkanDefragmenter::EndPass()
+	{
+		VulkanGarbageCollector& garbageCollector = VulkanRenderer::GetRenderer().GetGarbageCollector();
+		for (auto& relocation : m_Relocations)
+		{
+			// Note: The sampler doesn't reference the image's memory, so it was kept
+			garbageCollector.Collect(RelocatedImageGarbageEntry(relocation.OldImage, relocation.OldImageView));
+			m_MovedBytes += relocation.Size;
+		}
+		m_Relocations.clear();
+
+		VkResult result = vmaEndDefragmentationPass(VulkanAllocator::GetVmaAllocator(), m_Context, &m_Pass);
+		if ((result == VK_SUCCESS) || (m_Passes >= MaxPassesPerRun))
+			End();
+		else
+			m_State = State::Ready;
+	}
+
+	void VulkanDefragmenter::Relocate(ImageHandle image, VmaDefragmentationMove& move, VkCommandBuffer cmd)
+	{
+		VulkanImagePool& pool = VulkanImage::GetPool();
+
+		const ImageSpecification& specs = pool.Get<ImageColumn::Specification>(image);
+		uint32_t miplevels = pool.Get<ImageColumn::Miplevels>(image);
+		VkImage& currentImage = pool.Get<ImageColumn::Image>(image);
+		VkImageView& currentImageView = pool.Get<ImageColumn::ImageView>(image);
+
+		VkFormat format = ImageFormatToVkFormat(specs.Format);
+		VkImageLayout layout = ImageLayoutToVkImageLayout(specs.Layout);
+		VkImageAspectFlags aspect = VkFormatToVkImageAspectFlags(format);
+
+		VkImage newImage = VulkanAllocator::CreateBoundImage(move.dstTmpAllocation, specs.Width, specs.Height, miplevels, format, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | ImageUsageToVkImageUsage(specs.Usage));
+
+		VmaAllocationInfo allocationInfo = {};
+		vmaGetAllocationInfo(VulkanAllocator::GetVmaAllocator(), move.srcAllocation, &allocationInfo);
+
+		VkImageMemoryBarrier barriers[2] = { };
+		for (auto& barrier : barriers)
+		{
+			barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.subresourceRange.aspectMask = aspect;
+			barrier.subresourceRange.baseMipLevel = 0;
+			barrier.subresourceRange.levelCount = miplevels;
+			barrier.subresourceRange.baseArrayLayer = 0;
+			barrier.subresourceRange.layerCount = 1;
+		}
+
+		// Old image to transfer source, after whatever used the image last
+		barriers[0].image = currentImage;
+		barriers[0].oldLayout = layout;
+		barriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		barriers[0].srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+		barriers[0].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+		// New image to transfer destination, contents are overwritten anyway
+		barriers[1].image = newImage;
+		barriers[1].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		barriers[1].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barriers[1].srcAccessMask = 0;
+		barriers[1].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+		// Note: An image without defined contents has nothing worth copying
+		if (specs.Layout != ImageLayout::Undefined)
+		{
+			vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 2, barriers);
+			FrameStatistics::AddBarriers(2);
+
+			std::vector<VkImageCopy> regions(miplevels);
+			for (uint32_t mip = 0; mip < miplevels; mip++)
+			{
+				VkImageCopy& region = regions[mip];
+				region.srcSubresource.aspectMask = aspect;
+				region.srcSubresource.mipLevel = mip;
+				region.srcSubresource.baseArrayLayer = 0;
+				region.srcSubresource.layerCount = 1;
+				region.srcOffset = { 0, 0, 0 };
+				region.dstSubresource = region.srcSubresource;
+				region.dstOffset = { 0, 0, 0 };
+				region.extent = { std::max(specs.Width >> mip, 1u), std::max(specs.Height >> mip, 1u), 1 };
+			}
+
+			vkCmdCopyImage(cmd, currentImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, newImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(regions.size()), regions.data());
+
+			// New image back to the layout the image is tracked in
+			barriers[1].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			barriers[1].newLayout = layout;
+			barriers[1].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barriers[1].dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+			vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr, 1, &barriers[1]);
+			FrameStatistics::AddBarriers();
+		}
+
+		m_Relocations.emplace_back(&move, currentImage, currentImageView, static_cast<size_t>(allocationInfo.size));
+
+		// Note: Everyone refers to the image by handle, so patching the pool's slot updates all users
+		currentImage = newImage;
+		currentImageView = VulkanAllocator::CreateImageView(newImage, format, aspect, miplevels);
+	}
+
+}
\ No newline at end of file
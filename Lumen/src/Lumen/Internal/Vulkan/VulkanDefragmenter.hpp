@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Lumen/Internal/Vulkan/Vulkan.hpp"
+#include "Lumen/Internal/Vulkan/VulkanImage.hpp"
+#include "Lumen/Internal/Vulkan/VulkanGarbageCollector.hpp"
+
+#include "Lumen/Internal/Memory/FlatHashMap.hpp"
+
+#include "Lumen/Core/Core.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Lumen::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanDefragmenter
+    ////////////////////////////////////////////////////////////////////////////////////
+    class VulkanDefragmenter // Note: Only moves VulkanImage allocations, everything else is left in place
+    {
+    public:
+        // Settings
+        inline constexpr static const size_t MaxBytesPerFrame = 16ull * 1024 * 1024;
+        inline constexpr static const uint32_t MaxMovesPerFrame = 64;
+        inline constexpr static const uint32_t MaxPassesPerRun = 32;  // Note: Bounds runs where VMA keeps proposing moves we have to ignore
+        inline constexpr static const uint32_t IdleFrames = 120;      // Note: Frames to wait after a run before starting a new one
+    public:
+        // Constructor & Destructor
+        VulkanDefragmenter();
+        ~VulkanDefragmenter();
+
+        // Methods
+        void Register(ImageHandle image);
+        bool Unregister(ImageHandle image); // Note: Returns true if a run is active, the defragmenter then owns the image's handles & allocation and collects them once the run has ended
+
+        void Step(); // Note: Call once per frame, never blocks
+
+        // Getters
+        forceinline bool IsRunning() const { return (m_State != State::Idle); }
+        forceinline uint64_t GetMovedBytes() const { return m_MovedBytes; }
+
+    private:
+        enum class State : uint8_t { Idle = 0, Ready, Retiring };
+
+        struct Relocation
+        {
+        public:
+            VmaDefragmentationMove* Move = nullptr;
+
+            VkImage OldImage = VK_NULL_HANDLE;
+            VkImageView OldImageView = VK_NULL_HANDLE;
+
+            size_t Size = 0;
+        };
+
+    private:
+        // Private methods
+        void Begin();
+        void End(); // Note: Must not reach the renderer, since the destructor runs after it has been torn down
+
+        void BeginPass();
+        void EndPass();
+
+        void Relocate(ImageHandle image, VmaDefragmentationMove& move, VkCommandBuffer cmd);
+
+    private:
+        std::mutex m_ThreadSafety = {};
+        FlatHashMap<VmaAllocation, ImageHandle> m_Images = { };
+
+        State m_State = State::Idle;
+        uint32_t m_Target = 0;
+        uint32_t m_Passes = 0;
+        uint32_t m_Countdown = 0;
+
+        VmaDefragmentationContext m_Context = VK_NULL_HANDLE;
+        VmaDefragmentationPassMoveInfo m_Pass = {};
+        std::vector<Relocation> m_Relocations = { };
+        std::vector<ImageGarbageEntry> m_Orphans = { }; // Note: Images destroyed during a run, their allocations may still be part of a pass
+
+        VkCommandPool m_CommandPool = VK_NULL_HANDLE;
+        VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
+        VkFence m_Fence = VK_NULL_HANDLE;
+
+        uint64_t m_MovedBytes = 0;
+    };
+
+}
\ No newline at end of file
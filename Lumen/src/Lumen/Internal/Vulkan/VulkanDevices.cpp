@@ -2,9 +2,11 @@
 #include "VulkanDevices.hpp"
 
 #include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Enum/Flags.hpp"
 #include "Lumen/Internal/Utils/Settings.hpp"
 
 #include "Lumen/Internal/Vulkan/VulkanContext.hpp"
+#include "Lumen/Internal/Vulkan/VulkanHostAllocator.hpp"
 
 #include <tuple>
 #include <ranges>
@@ -112,11 +114,11 @@ namespace Lumen::Internal
         uint32_t queueFamilyCount;
 		vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, nullptr);
 
-		std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
-		vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
+		SmallVector<VkQueueFamilyProperties, 8> queueFamilies(queueFamilyCount);
+		vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.Data());
 
         QueueFamilyIndices indices = {};
-        indices.Queues.resize(queueFamilyCount);
+        indices.Queues.Resize(queueFamilyCount);
 
         // Create into readable format
 		for (uint32_t i = 0; i < queueFamilyCount; i++)
@@ -131,6 +133,8 @@ namespace Lumen::Internal
 			vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
             if (presentSupport)
                 info.Flags |= QueueFamilyFlags::Present;
+
+            LU_LOG_TRACE("[VkPhysicalDevice] Queue family {0}: {1} queues, {2}", i, info.Count, info.Flags);
 		}
 
         // Make choices
@@ -173,16 +177,16 @@ namespace Lumen::Internal
 		vkGetPhysicalDeviceSurfaceFormatsKHR(device, surface, &formatCount, nullptr);
 
         LU_ASSERT((formatCount != 0), "[VkPhysicalDevice] GPU doesn't support any formats?");
-		details.Formats.resize(static_cast<size_t>(formatCount));
-		vkGetPhysicalDeviceSurfaceFormatsKHR(device, surface, &formatCount, details.Formats.data());
+		details.Formats.Resize(static_cast<size_t>(formatCount));
+		vkGetPhysicalDeviceSurfaceFormatsKHR(device, surface, &formatCount, details.Formats.Data());
 
 		// Presentation modes
 		uint32_t presentModeCount;
 		vkGetPhysicalDeviceSurfacePresentModesKHR(device, surface, &presentModeCount, nullptr);
 
         LU_ASSERT((formatCount != 0), "[VkPhysicalDevice] GPU doesn't support any presentmodes?");
-		details.PresentModes.resize(static_cast<size_t>(presentModeCount));
-		vkGetPhysicalDeviceSurfacePresentModesKHR(device, surface, &presentModeCount, details.PresentModes.data());
+		details.PresentModes.Resize(static_cast<size_t>(presentModeCount));
+		vkGetPhysicalDeviceSurfacePresentModesKHR(device, surface, &presentModeCount, details.PresentModes.Data());
 
 		return details;
 	}
@@ -256,7 +260,7 @@ namespace Lumen::Internal
 		if (extensionsSupported)
 		{
 			SwapChainSupportDetails swapChainSupport = SwapChainSupportDetails::Query(surface, device);
-			swapChainAdequate = !swapChainSupport.Formats.empty() && !swapChainSupport.PresentModes.empty();
+			swapChainAdequate = !swapChainSupport.Formats.Empty() && !swapChainSupport.PresentModes.Empty();
 		}
 
         VkPhysicalDeviceFeatures supportedFeatures = {};
@@ -399,6 +403,7 @@ namespace Lumen::Internal
 		: m_PhysicalDevice(physicalDevice)
 	{
 		QueueFamilyIndices indices = QueueFamilyIndices::Find(surface, m_PhysicalDevice.GetVkPhysicalDevice());
+        m_QueueFamily = indices.QueueFamily;
 
         uint32_t queueCount = (indices.SameQueue() ? 1 : 3);
         std::vector<float> queuePriorities(queueCount, 1.0f);
@@ -423,8 +428,44 @@ namespace Lumen::Internal
 		createInfo.queueCreateInfoCount = 1;
 		createInfo.pQueueCreateInfos = &queueCreateInfo;
 		createInfo.pEnabledFeatures = &s_RequestedDeviceFeatures;
-		createInfo.enabledExtensionCount = static_cast<uint32_t>(VulkanContext::DeviceExtensions.size());
-		createInfo.ppEnabledExtensionNames = VulkanContext::DeviceExtensions.data();
+		// Required & supported optional extensions
+        {
+            uint32_t extensionCount;
+            vkEnumerateDeviceExtensionProperties(m_PhysicalDevice.GetVkPhysicalDevice(), nullptr, &extensionCount, nullptr);
+
+            std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+            vkEnumerateDeviceExtensionProperties(m_PhysicalDevice.GetVkPhysicalDevice(), nullptr, &extensionCount, availableExtensions.data());
+
+            m_Extensions.assign(VulkanContext::DeviceExtensions.begin(), VulkanContext::DeviceExtensions.end());
+
+            for (const char* optional : VulkanContext::OptionalDeviceExtensions)
+            {
+                if (std::ranges::any_of(availableExtensions, [&](const VkExtensionProperties& properties) { return std::string_view(properties.extensionName) == optional; }))
+                    m_Extensions.push_back(optional);
+            }
+        }
+
+		// Present id & wait features // Note: Only enabled when both extensions are
+		VkPhysicalDevicePresentWaitFeaturesKHR presentWaitFeatures = {};
+		presentWaitFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+		VkPhysicalDevicePresentIdFeaturesKHR presentIdFeatures = {};
+		presentIdFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+		presentIdFeatures.pNext = &presentWaitFeatures;
+
+		if (IsExtensionEnabled(VK_KHR_PRESENT_ID_EXTENSION_NAME) && IsExtensionEnabled(VK_KHR_PRESENT_WAIT_EXTENSION_NAME))
+		{
+			VkPhysicalDeviceFeatures2 features = {};
+			features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+			features.pNext = &presentIdFeatures;
+			vkGetPhysicalDeviceFeatures2(m_PhysicalDevice.GetVkPhysicalDevice(), &features);
+
+			m_PresentWait = (presentIdFeatures.presentId && presentWaitFeatures.presentWait);
+			if (m_PresentWait)
+				indexingFeatures.pNext = &presentIdFeatures; // Chain present id & wait
+		}
+
+		createInfo.enabledExtensionCount = static_cast<uint32_t>(m_Extensions.size());
+		createInfo.ppEnabledExtensionNames = m_Extensions.data();
 
 		if constexpr (VulkanContext::Validation)
 		{
@@ -436,7 +477,7 @@ namespace Lumen::Internal
 			createInfo.enabledLayerCount = 0;
 		}
 
-		VK_VERIFY(vkCreateDevice(m_PhysicalDevice.GetVkPhysicalDevice(), &createInfo, nullptr, &m_LogicalDevice));
+		VK_VERIFY(vkCreateDevice(m_PhysicalDevice.GetVkPhysicalDevice(), &createInfo, VulkanHostAllocator::GetCallbacks(), &m_LogicalDevice));
 
 		// Retrieve the graphics/compute/present queue handle
         {
@@ -458,7 +499,7 @@ namespace Lumen::Internal
 
 	VulkanDevice::~VulkanDevice()
 	{
-		vkDestroyDevice(m_LogicalDevice, nullptr);
+		vkDestroyDevice(m_LogicalDevice, VulkanHostAllocator::GetCallbacks());
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -469,4 +510,9 @@ namespace Lumen::Internal
         VK_VERIFY(vkDeviceWaitIdle(m_LogicalDevice));
 	}
 
+	bool VulkanDevice::IsExtensionEnabled(std::string_view extension) const
+	{
+        return std::ranges::any_of(m_Extensions, [&](const char* enabled) { return extension == enabled; });
+	}
+
 }
\ No newline at end of file
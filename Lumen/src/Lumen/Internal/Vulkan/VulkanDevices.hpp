@@ -4,10 +4,14 @@
 
 #include "Lumen/Internal/Enum/Bitwise.hpp"
 
+#include "Lumen/Internal/Memory/SmallVector.hpp"
+
 #include "Lumen/Core/Core.hpp"
 
 #include <cstdint>
+#include <vector>
 #include <optional>
+#include <string_view>
 
 namespace Lumen::Internal
 {
@@ -53,7 +57,7 @@ namespace Lumen::Internal
         uint32_t ComputeQueue = 0;
         uint32_t PresentQueue = 0;
 
-        std::vector<QueueFamilyInfo> Queues = {};
+        SmallVector<QueueFamilyInfo, 8> Queues = {}; // Note: Devices expose a handful of families, so this stays inline
 
         bool CompletedQueues = false;
 
@@ -70,8 +74,8 @@ namespace Lumen::Internal
     {
     public:
         VkSurfaceCapabilitiesKHR Capabilities;
-        std::vector<VkSurfaceFormatKHR> Formats;
-        std::vector<VkPresentModeKHR> PresentModes;
+        SmallVector<VkSurfaceFormatKHR, 8> Formats;
+        SmallVector<VkPresentModeKHR, 8> PresentModes;
 
     public:
         static SwapChainSupportDetails Query(VkSurfaceKHR surface, VkPhysicalDevice device);
@@ -119,6 +123,9 @@ namespace Lumen::Internal
         // Methods
         void Wait() const;
 
+        bool IsExtensionEnabled(std::string_view extension) const;
+        forceinline bool SupportsPresentWait() const { return m_PresentWait; } // Note: VK_KHR_present_id & VK_KHR_present_wait, including their features
+
         // Getters
         forceinline VkDevice GetVkDevice() const { return m_LogicalDevice; }
 
@@ -126,6 +133,8 @@ namespace Lumen::Internal
         forceinline VkQueue GetComputeQueue() const { return m_ComputeQueue; }
         forceinline VkQueue GetPresentQueue() const { return m_PresentQueue; }
 
+        forceinline uint32_t GetQueueFamily() const { return m_QueueFamily; }
+
         forceinline VulkanPhysicalDevice& GetPhysicalDevice() const { return m_PhysicalDevice; }
 
     private:
@@ -135,6 +144,11 @@ namespace Lumen::Internal
         VkQueue m_GraphicsQueue = VK_NULL_HANDLE;
         VkQueue m_ComputeQueue = VK_NULL_HANDLE;
         VkQueue m_PresentQueue = VK_NULL_HANDLE;
+
+        uint32_t m_QueueFamily = 0;
+
+        std::vector<const char*> m_Extensions = { };
+        bool m_PresentWait = false;
     };
 
 }
@@ -2,6 +2,7 @@
 #include "VulkanGarbageCollector.hpp"
 
 #include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Utils/FrameStatistics.hpp"
 
 #include "Lumen/Internal/Vulkan/VulkanContext.hpp"
 #include "Lumen/Internal/Vulkan/VulkanRenderer.hpp"
@@ -13,23 +14,45 @@ namespace Lumen::Internal
     // Methods
     ////////////////////////////////////////////////////////////////////////////////////
     void VulkanGarbageCollector::Dispose()
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+        Dispose(GetCurrentGarbage());
+    }
+
+    void VulkanGarbageCollector::DisposeAll()
     {
         std::scoped_lock<std::mutex> lock(m_ThreadSafety);
 
+        for (auto& garbage : m_Garbage)
+            Dispose(garbage);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    VulkanGarbageCollector::Garbage& VulkanGarbageCollector::GetCurrentGarbage()
+    {
+        return m_Garbage[VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame()];
+    }
+
+    void VulkanGarbageCollector::Dispose(Garbage& garbage)
+    {
         VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
         VulkanRenderer& renderer = VulkanRenderer::GetRenderer();
 
+        FrameStatistics::AddGarbageEntries(static_cast<uint32_t>(garbage.CommandBuffers.size() + garbage.Images.size() + garbage.RelocatedImages.size() + garbage.SwapChains.size()));
+
         // CommandBuffers
-        if (!m_CommandBuffers.empty()) // [[unlikely]]
+        if (!garbage.CommandBuffers.empty()) // [[unlikely]]
         {
-            vkFreeCommandBuffers(device, renderer.GetVkCommandPool(), static_cast<uint32_t>(m_CommandBuffers.size()), m_CommandBuffers.data());
-            m_CommandBuffers.clear();
+            vkFreeCommandBuffers(device, renderer.GetVkCommandPool(), static_cast<uint32_t>(garbage.CommandBuffers.size()), garbage.CommandBuffers.data());
+            garbage.CommandBuffers.clear();
         }
 
         // Images
-        if (!m_Images.empty()) // [[unlikely]]
+        if (!garbage.Images.empty()) // [[unlikely]]
         {
-            for (auto& image : m_Images)
+            for (auto& image : garbage.Images)
             {
                 if (image.Sampler)
                     vkDestroySampler(device, image.Sampler, nullptr);
@@ -39,7 +62,32 @@ namespace Lumen::Internal
                 if (image.Image != VK_NULL_HANDLE && image.Allocation != VK_NULL_HANDLE)
                     VulkanAllocator::DestroyImage(image.Image, image.Allocation);
             }
-            m_Images.clear();
+            garbage.Images.clear();
+        }
+
+        // Relocated images
+        if (!garbage.RelocatedImages.empty()) // [[unlikely]]
+        {
+            for (auto& image : garbage.RelocatedImages)
+            {
+                if (image.Sampler)
+                    vkDestroySampler(device, image.Sampler, nullptr);
+                if (image.ImageView)
+                    vkDestroyImageView(device, image.ImageView, nullptr);
+                if (image.Image)
+                    vkDestroyImage(device, image.Image, nullptr);
+            }
+            garbage.RelocatedImages.clear();
+        }
+
+        // SwapChains
+        // Note: After the images, since the views of swapchain images must be destroyed before the swapchain
+        if (!garbage.SwapChains.empty()) // [[unlikely]]
+        {
+            for (auto& swapChain : garbage.SwapChains)
+                vkDestroySwapchainKHR(device, swapChain.SwapChain, nullptr);
+
+            garbage.SwapChains.clear();
         }
     }
 
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "Lumen/Internal/Renderer/RendererSpec.hpp"
+
+#include "Lumen/Internal/Memory/Array.hpp"
+
 #include "Lumen/Internal/Vulkan/Vulkan.hpp"
 
 #include "Lumen/Core/Core.hpp"
@@ -42,10 +46,38 @@ namespace Lumen::Internal
         ~ImageGarbageEntry() = default;
     };
 
+    struct RelocatedImageGarbageEntry // Note: An image whose memory is owned by someone else (the defragmenter), so only the handles are destroyed
+    {
+    public:
+        VkImage Image = VK_NULL_HANDLE;
+        VkImageView ImageView = VK_NULL_HANDLE;
+        VkSampler Sampler = VK_NULL_HANDLE;
+
+    public:
+        // Constructors & Destructor
+        RelocatedImageGarbageEntry() = default;
+        forceinline RelocatedImageGarbageEntry(VkImage image, VkImageView imageView, VkSampler sampler = VK_NULL_HANDLE)
+            : Image(image), ImageView(imageView), Sampler(sampler) {}
+        ~RelocatedImageGarbageEntry() = default;
+    };
+
+    struct SwapChainGarbageEntry // Note: A retired swapchain, its images are destroyed along with it
+    {
+    public:
+        VkSwapchainKHR SwapChain = VK_NULL_HANDLE;
+
+    public:
+        // Constructors & Destructor
+        SwapChainGarbageEntry() = default;
+        forceinline SwapChainGarbageEntry(VkSwapchainKHR swapChain)
+            : SwapChain(swapChain) {}
+        ~SwapChainGarbageEntry() = default;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // VulkanGarbageCollector
     ////////////////////////////////////////////////////////////////////////////////////
-    class VulkanGarbageCollector
+    class VulkanGarbageCollector // Note: Garbage is bucketed by the frame it was collected in and disposed once that frame's fence has been waited on
     {
     public:
         // Constructor & Destructor
@@ -59,13 +91,31 @@ namespace Lumen::Internal
         void Collect(ImageGarbageEntry image);
         void Collect(std::initializer_list<ImageGarbageEntry> images);
 
-        void Dispose();
+        void Collect(RelocatedImageGarbageEntry image);
+        void Collect(SwapChainGarbageEntry swapChain);
+
+        void Dispose(); // Note: Disposes the current frame's garbage, call after waiting on the frame's fence
+        void DisposeAll(); // Note: Only safe when the device is idle
+
+    private:
+        struct Garbage
+        {
+        public:
+            std::vector<VkCommandBuffer> CommandBuffers = { };
+            std::vector<ImageGarbageEntry> Images = { };
+            std::vector<RelocatedImageGarbageEntry> RelocatedImages = { };
+            std::vector<SwapChainGarbageEntry> SwapChains = { };
+        };
+
+    private:
+        // Private methods
+        Garbage& GetCurrentGarbage();
+        void Dispose(Garbage& garbage);
 
     private:
         std::mutex m_ThreadSafety = {};
 
-        std::vector<VkCommandBuffer> m_CommandBuffers = { };
-        std::vector<ImageGarbageEntry> m_Images = { };
+        Array<Garbage, RendererSpecification::MaxFramesInFlight> m_Garbage = { };
     };
 
 }
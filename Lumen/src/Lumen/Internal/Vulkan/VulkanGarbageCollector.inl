@@ -8,32 +8,46 @@ namespace Lumen::Internal
     hintinline void VulkanGarbageCollector::Collect(CommandBufferGarbageEntry commandBuffer)
     {
         std::scoped_lock<std::mutex> lock(m_ThreadSafety);
-        m_CommandBuffers.push_back(commandBuffer.CommandBuffer);
+        GetCurrentGarbage().CommandBuffers.push_back(commandBuffer.CommandBuffer);
     }
 
     hintinline void VulkanGarbageCollector::Collect(std::initializer_list<CommandBufferGarbageEntry> commandBuffers)
     {
         std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+        std::vector<VkCommandBuffer>& garbage = GetCurrentGarbage().CommandBuffers;
 
-        m_CommandBuffers.reserve(m_CommandBuffers.size() + commandBuffers.size());
+        garbage.reserve(garbage.size() + commandBuffers.size());
 
         // Note: This is currently allows since a CommandBufferGarbageEntry is just a wrapper around VkCommandBuffer
         const VkCommandBuffer* ptr = reinterpret_cast<const VkCommandBuffer*>(commandBuffers.begin());
-        m_CommandBuffers.insert(m_CommandBuffers.end(), ptr, ptr + commandBuffers.size());
+        garbage.insert(garbage.end(), ptr, ptr + commandBuffers.size());
     }
 
     hintinline void VulkanGarbageCollector::Collect(ImageGarbageEntry image)
     {
         std::scoped_lock<std::mutex> lock(m_ThreadSafety);
-        m_Images.push_back(image);
+        GetCurrentGarbage().Images.push_back(image);
     }
 
     hintinline void VulkanGarbageCollector::Collect(std::initializer_list<ImageGarbageEntry> images)
     {
         std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+        std::vector<ImageGarbageEntry>& garbage = GetCurrentGarbage().Images;
 
-        m_Images.reserve(m_Images.size() + images.size());
-        m_Images.insert(m_Images.end(), images.begin(), images.end());
+        garbage.reserve(garbage.size() + images.size());
+        garbage.insert(garbage.end(), images.begin(), images.end());
+    }
+
+    hintinline void VulkanGarbageCollector::Collect(RelocatedImageGarbageEntry image)
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+        GetCurrentGarbage().RelocatedImages.push_back(image);
+    }
+
+    hintinline void VulkanGarbageCollector::Collect(SwapChainGarbageEntry swapChain)
+    {
+        std::scoped_lock<std::mutex> lock(m_ThreadSafety);
+        GetCurrentGarbage().SwapChains.push_back(swapChain);
     }
 
 }
\ No newline at end of file
@@ -0,0 +1,320 @@
+#include "lupch.h"
+#include "VulkanHostAllocator.hpp"
+
+#include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Utils/Profiler.hpp"
+
+#include <bit>
+#include <new>
+#include <mutex>
+#include <atomic>
+#include <cstring>
+
+namespace
+{
+
+    using namespace Lumen::Internal;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Blocks
+    ////////////////////////////////////////////////////////////////////////////////////
+    inline constexpr const size_t ClassCount = std::countr_zero(VulkanHostAllocator::MaxClassSize) - std::countr_zero(VulkanHostAllocator::MinClassSize) + 1;
+    inline constexpr const uint32_t NoClass = std::numeric_limits<uint32_t>::max();
+
+    struct ThreadCache;
+
+    struct BlockHeader // Note: Lives in the HeaderSize bytes right before the returned pointer
+    {
+    public:
+        void* Base = nullptr;          // Note: Start of the underlying allocation, only used for non-pooled blocks
+        ThreadCache* Owner = nullptr;  // Note: The cache the block was carved from, only used for pooled blocks
+        size_t Size = 0;
+        uint32_t Class = NoClass;
+        uint32_t Scope = 0;
+    };
+    static_assert((sizeof(BlockHeader) <= VulkanHostAllocator::HeaderSize), "BlockHeader must fit in the reserved header space.");
+
+    struct FreeBlock
+    {
+    public:
+        FreeBlock* Next = nullptr;
+    };
+
+    forceinline BlockHeader* GetHeader(void* memory)
+    {
+        return reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(memory) - VulkanHostAllocator::HeaderSize);
+    }
+
+    forceinline constexpr uint32_t GetClass(size_t size)
+    {
+        size_t total = std::max(size + VulkanHostAllocator::HeaderSize, VulkanHostAllocator::MinClassSize);
+        return static_cast<uint32_t>(std::bit_width(total - 1) - std::countr_zero(VulkanHostAllocator::MinClassSize));
+    }
+
+    forceinline constexpr size_t GetClassSize(uint32_t sizeClass)
+    {
+        return VulkanHostAllocator::MinClassSize << sizeClass;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Pools
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Note: Blocks always return to the cache they were carved from, so allocating on one thread & freeing
+    //       on another (like the garbage collector does) doesn't move memory between caches forever.
+    struct ThreadCache
+    {
+    public:
+        Array<FreeBlock*, ClassCount> FreeLists = { };                // Note: Only touched by the owning thread
+        Array<std::atomic<FreeBlock*>, ClassCount> RemoteFrees = { }; // Note: Blocks freed by other threads, pushed lock free
+
+        ThreadCache* NextOrphan = nullptr;
+
+    public:
+        // Methods
+        void* Pop(uint32_t sizeClass)
+        {
+            if (!FreeLists[sizeClass]) [[unlikely]]
+                Refill(sizeClass);
+
+            FreeBlock* block = FreeLists[sizeClass];
+            FreeLists[sizeClass] = block->Next;
+            return block;
+        }
+
+        forceinline void Push(uint32_t sizeClass, void* memory)
+        {
+            FreeBlock* block = static_cast<FreeBlock*>(memory);
+            block->Next = FreeLists[sizeClass];
+            FreeLists[sizeClass] = block;
+        }
+
+        forceinline void PushRemote(uint32_t sizeClass, void* memory)
+        {
+            // Note: Only the owner takes blocks off, and always the whole list at once, so there is no ABA problem
+            FreeBlock* block = static_cast<FreeBlock*>(memory);
+            block->Next = RemoteFrees[sizeClass].load(std::memory_order_relaxed);
+            while (!RemoteFrees[sizeClass].compare_exchange_weak(block->Next, block, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+    private:
+        void Refill(uint32_t sizeClass)
+        {
+            // Take back the blocks other threads have freed first
+            if (FreeBlock* remote = RemoteFrees[sizeClass].exchange(nullptr, std::memory_order_acquire))
+            {
+                FreeLists[sizeClass] = remote;
+                return;
+            }
+
+            // Note: Chunks are never returned, the caches only grow to the peak usage of the driver
+            uint8_t* chunk = static_cast<uint8_t*>(::operator new(VulkanHostAllocator::ChunkSize, std::align_val_t(VulkanHostAllocator::HeaderSize)));
+
+            size_t classSize = GetClassSize(sizeClass);
+            for (size_t offset = 0; offset + classSize <= VulkanHostAllocator::ChunkSize; offset += classSize)
+                Push(sizeClass, chunk + offset);
+        }
+    };
+
+    // Note: Caches of exiting threads are kept alive here, since their blocks may still be freed remotely.
+    //       New threads adopt them, so the amount of caches is bounded by the peak amount of threads.
+    static std::mutex s_OrphanLock = {};
+    static ThreadCache* s_Orphans = nullptr;
+
+    struct ThreadPool
+    {
+    public:
+        ThreadCache* Cache = nullptr;
+
+    public:
+        // Constructor & Destructor
+        ThreadPool() = default;
+        ~ThreadPool()
+        {
+            if (!Cache)
+                return;
+
+            std::scoped_lock<std::mutex> lock(s_OrphanLock);
+            Cache->NextOrphan = s_Orphans;
+            s_Orphans = Cache;
+            Cache = nullptr;
+        }
+
+        // Methods
+        forceinline ThreadCache& Get()
+        {
+            if (!Cache) [[unlikely]]
+                Acquire();
+
+            return *Cache;
+        }
+
+    private:
+        void Acquire()
+        {
+            {
+                std::scoped_lock<std::mutex> lock(s_OrphanLock);
+                if (s_Orphans)
+                {
+                    Cache = s_Orphans;
+                    s_Orphans = Cache->NextOrphan;
+                    Cache->NextOrphan = nullptr;
+                    return;
+                }
+            }
+
+            Cache = new ThreadCache();
+        }
+    };
+
+    static thread_local ThreadPool s_ThreadPool = {};
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Telemetry
+    ////////////////////////////////////////////////////////////////////////////////////
+    static Array<std::atomic<int64_t>, VulkanHostTelemetry::ScopeCount> s_Bytes = { };
+    static Array<std::atomic<int64_t>, VulkanHostTelemetry::ScopeCount> s_Allocations = { };
+    static std::atomic<uint64_t> s_PooledAllocations = 0;
+
+}
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Static methods
+	////////////////////////////////////////////////////////////////////////////////////
+	const VkAllocationCallbacks* VulkanHostAllocator::GetCallbacks()
+	{
+		static const VkAllocationCallbacks s_Callbacks = {
+			.pUserData = nullptr,
+			.pfnAllocation = &VulkanHostAllocator::Allocate,
+			.pfnReallocation = &VulkanHostAllocator::Reallocate,
+			.pfnFree = &VulkanHostAllocator::Free,
+			.pfnInternalAllocation = nullptr,
+			.pfnInternalFree = nullptr,
+		};
+
+		return &s_Callbacks;
+	}
+
+	VulkanHostTelemetry VulkanHostAllocator::GetTelemetry()
+	{
+		VulkanHostTelemetry telemetry = {};
+
+		for (size_t i = 0; i < VulkanHostTelemetry::ScopeCount; i++)
+		{
+			telemetry.Bytes[i] = static_cast<uint64_t>(std::max<int64_t>(s_Bytes[i].load(std::memory_order_relaxed), 0));
+			telemetry.Allocations[i] = static_cast<uint64_t>(std::max<int64_t>(s_Allocations[i].load(std::memory_order_relaxed), 0));
+		}
+		telemetry.PooledAllocations = s_PooledAllocations.load(std::memory_order_relaxed);
+
+		return telemetry;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Callbacks
+	////////////////////////////////////////////////////////////////////////////////////
+	void* VKAPI_PTR VulkanHostAllocator::Allocate(void*, size_t size, size_t alignment, VkSystemAllocationScope scope)
+	{
+		if (size == 0) [[unlikely]]
+			return nullptr;
+
+		LU_ASSERT(std::has_single_bit(alignment), "[VkHostAllocator] Alignment must be a power of two.");
+
+		bool poolable = ((scope == VK_SYSTEM_ALLOCATION_SCOPE_COMMAND) || (scope == VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
+		poolable &= ((alignment <= HeaderSize) && (size + HeaderSize <= MaxClassSize));
+
+		uint8_t* memory = nullptr;
+		BlockHeader header = {};
+		header.Size = size;
+		header.Scope = static_cast<uint32_t>(scope);
+
+		if (poolable) [[likely]]
+		{
+			// Note: Blocks are HeaderSize aligned, so the returned pointer is too
+			ThreadCache& cache = s_ThreadPool.Get();
+
+			header.Class = GetClass(size);
+			header.Owner = &cache;
+			memory = static_cast<uint8_t*>(cache.Pop(header.Class)) + HeaderSize;
+
+			s_PooledAllocations.fetch_add(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			alignment = std::max(alignment, alignof(std::max_align_t));
+
+			void* base = std::malloc(size + alignment + HeaderSize);
+			if (!base) [[unlikely]]
+				return nullptr;
+
+			uintptr_t address = reinterpret_cast<uintptr_t>(base) + HeaderSize;
+			address = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+
+			header.Base = base;
+			memory = reinterpret_cast<uint8_t*>(address);
+		}
+
+		*GetHeader(memory) = header;
+
+		s_Bytes[header.Scope].fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+		s_Allocations[header.Scope].fetch_add(1, std::memory_order_relaxed);
+
+		return memory;
+	}
+
+	void* VKAPI_PTR VulkanHostAllocator::Reallocate(void* userData, void* original, size_t size, size_t alignment, VkSystemAllocationScope scope)
+	{
+		if (!original)
+			return Allocate(userData, size, alignment, scope);
+
+		if (size == 0)
+		{
+			Free(userData, original);
+			return nullptr;
+		}
+
+		BlockHeader* header = GetHeader(original);
+
+		// Note: A pooled block that still fits can be reused as is
+		if ((header->Class != NoClass) && (header->Scope == static_cast<uint32_t>(scope)) && (alignment <= HeaderSize) && (size + HeaderSize <= GetClassSize(header->Class)))
+		{
+			s_Bytes[header->Scope].fetch_add(static_cast<int64_t>(size) - static_cast<int64_t>(header->Size), std::memory_order_relaxed);
+			header->Size = size;
+			return original;
+		}
+
+		void* memory = Allocate(userData, size, alignment, scope);
+		if (!memory) [[unlikely]]
+			return nullptr; // Note: The original must stay valid on failure
+
+		std::memcpy(memory, original, std::min(size, header->Size));
+		Free(userData, original);
+
+		return memory;
+	}
+
+	void VKAPI_PTR VulkanHostAllocator::Free(void*, void* memory)
+	{
+		if (!memory)
+			return;
+
+		BlockHeader* header = GetHeader(memory);
+
+		s_Bytes[header->Scope].fetch_sub(static_cast<int64_t>(header->Size), std::memory_order_relaxed);
+		s_Allocations[header->Scope].fetch_sub(1, std::memory_order_relaxed);
+
+		if (header->Class == NoClass) [[unlikely]]
+		{
+			std::free(header->Base);
+			return;
+		}
+
+		// Note: Pooled blocks go back to their owner's cache, through its remote list if the owner is another thread
+		if (header->Owner == s_ThreadPool.Cache) [[likely]]
+			header->Owner->Push(header->Class, reinterpret_cast<uint8_t*>(header));
+		else
+			header->Owner->PushRemote(header->Class, reinterpret_cast<uint8_t*>(header));
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Lumen/Internal/Memory/Array.hpp"
+
+#include "Lumen/Internal/Vulkan/Vulkan.hpp"
+
+#include "Lumen/Core/Core.hpp"
+
+#include <cstdint>
+
+namespace Lumen::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanHostTelemetry
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct VulkanHostTelemetry
+    {
+    public:
+        inline constexpr static const size_t ScopeCount = static_cast<size_t>(VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE) + 1;
+    public:
+        Array<uint64_t, ScopeCount> Bytes = { };       // Indexed by VkSystemAllocationScope
+        Array<uint64_t, ScopeCount> Allocations = { }; // Indexed by VkSystemAllocationScope
+
+        uint64_t PooledAllocations = 0; // Total allocations served from the thread local pools
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanHostAllocator
+    ////////////////////////////////////////////////////////////////////////////////////
+    class VulkanHostAllocator // Note: Host memory for the driver & VMA, command & object scope allocations are served from thread local size classes
+    {
+    public:
+        // Settings
+        inline constexpr static const size_t HeaderSize = 32;            // Note: Also the largest alignment the pools can honour
+        inline constexpr static const size_t MinClassSize = 64;          // Note: Includes the header
+        inline constexpr static const size_t MaxClassSize = 4096;        // Note: Includes the header
+        inline constexpr static const size_t ChunkSize = 64ull * 1024;   // Note: Size of the blocks the pools are carved from
+    public:
+        // Static methods
+        static const VkAllocationCallbacks* GetCallbacks();
+        static VulkanHostTelemetry GetTelemetry();
+
+    private:
+        // Callbacks
+        static void* VKAPI_PTR Allocate(void* userData, size_t size, size_t alignment, VkSystemAllocationScope scope);
+        static void* VKAPI_PTR Reallocate(void* userData, void* original, size_t size, size_t alignment, VkSystemAllocationScope scope);
+        static void VKAPI_PTR Free(void* userData, void* memory);
+    };
+
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "Lumen/Internal/IO/Print.hpp"
 #include "Lumen/Internal/Utils/Profiler.hpp"
+#include "Lumen/Internal/Utils/FrameStatistics.hpp"
 
 #include "Lumen/Internal/Enum/Fuse.hpp"
 
@@ -44,8 +45,9 @@ namespace Lumen::Internal
     {
         DestroyImage();
 
-        m_ImageSpecification.Width = width;
-        m_ImageSpecification.Height = height;
+        ImageSpecification& specs = s_Pool.Get<ImageColumn::Specification>(m_Handle);
+        specs.Width = width;
+        specs.Height = height;
 
         CreateImage(cmd, width, height);
     }
@@ -55,10 +57,11 @@ namespace Lumen::Internal
         if (initial == final)
             return;
 
-        auto [srcStage, dstStage, imageBarrier] = GetImageBarrier(ImageLayoutToVkImageLayout(initial), ImageLayoutToVkImageLayout(final), m_Miplevels);
+        auto [srcStage, dstStage, imageBarrier] = GetImageBarrier(ImageLayoutToVkImageLayout(initial), ImageLayoutToVkImageLayout(final), GetMiplevels());
         vkCmdPipelineBarrier(cmd.GetInternalCommandBuffer().GetVkCommandBuffer(), srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+        FrameStatistics::AddBarriers();
 
-        m_ImageSpecification.Layout = final;
+        s_Pool.Get<ImageColumn::Specification>(m_Handle).Layout = final;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -66,21 +69,35 @@ namespace Lumen::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     void VulkanImage::CreateImage(const CommandBuffer& cmd, uint32_t width, uint32_t height)
     {
-        ImageLayout desiredLayout = m_ImageSpecification.Layout;
+        LU_MEM_TAG(Images);
 
-        if (m_ImageSpecification.MipMaps)
-            m_Miplevels = static_cast<uint32_t>(std::floor(std::log2(std::max(width, height)))) + 1;
+        // Note: Pages in the pool never move, so these references stay valid while other images are created
+        ImageSpecification& specs = s_Pool.Get<ImageColumn::Specification>(m_Handle);
+        uint32_t& miplevels = s_Pool.Get<ImageColumn::Miplevels>(m_Handle);
+        VkImage& image = s_Pool.Get<ImageColumn::Image>(m_Handle);
 
-        m_Allocation = VulkanAllocator::AllocateImage(VMA_MEMORY_USAGE_GPU_ONLY, m_Image, width, height, m_Miplevels, ImageFormatToVkFormat(m_ImageSpecification.Format), VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | ImageUsageToVkImageUsage(m_ImageSpecification.Usage));
-        m_ImageView = VulkanAllocator::CreateImageView(m_Image, ImageFormatToVkFormat(m_ImageSpecification.Format), VkFormatToVkImageAspectFlags(ImageFormatToVkFormat(m_ImageSpecification.Format)), m_Miplevels);
-        m_Sampler = VulkanAllocator::CreateSampler(FilterModeToVkFilter(m_SamplerSpecification.MagFilter), FilterModeToVkFilter(m_SamplerSpecification.MinFilter), AddressModeToVkSamplerAddressMode(m_SamplerSpecification.Address), MipmapModeToVkSamplerMipmapMode(m_SamplerSpecification.Mipmaps), m_Miplevels);
+        ImageLayout desiredLayout = specs.Layout;
+
+        if (specs.MipMaps)
+            miplevels = static_cast<uint32_t>(std::floor(std::log2(std::max(width, height)))) + 1;
+
+        s_Pool.Get<ImageColumn::Allocation>(m_Handle) = VulkanAllocator::AllocateImage(VMA_MEMORY_USAGE_GPU_ONLY, image, width, height, miplevels, ImageFormatToVkFormat(specs.Format), VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | ImageUsageToVkImageUsage(specs.Usage));
+        s_Pool.Get<ImageColumn::ImageView>(m_Handle) = VulkanAllocator::CreateImageView(image, ImageFormatToVkFormat(specs.Format), VkFormatToVkImageAspectFlags(ImageFormatToVkFormat(specs.Format)), miplevels);
+        s_Pool.Get<ImageColumn::Sampler>(m_Handle) = VulkanAllocator::CreateSampler(FilterModeToVkFilter(m_SamplerSpecification.MagFilter), FilterModeToVkFilter(m_SamplerSpecification.MinFilter), AddressModeToVkSamplerAddressMode(m_SamplerSpecification.Address), MipmapModeToVkSamplerMipmapMode(m_SamplerSpecification.Mipmaps), miplevels);
+        VulkanRenderer::GetRenderer().GetDefragmenter().Register(m_Handle);
 
         Transition(cmd, ImageLayout::Undefined, desiredLayout);
     }
 
     void VulkanImage::CreateImage(const CommandBuffer& cmd, const std::filesystem::path& imagePath)
     {
-        ImageLayout desiredLayout = m_ImageSpecification.Layout;
+        LU_MEM_TAG(Images);
+
+        ImageSpecification& specs = s_Pool.Get<ImageColumn::Specification>(m_Handle);
+        uint32_t& miplevels = s_Pool.Get<ImageColumn::Miplevels>(m_Handle);
+        VkImage& image = s_Pool.Get<ImageColumn::Image>(m_Handle);
+
+        ImageLayout desiredLayout = specs.Layout;
 
         int width, height, texChannels;
 
@@ -89,17 +106,18 @@ namespace Lumen::Internal
 
         LU_ASSERT((pixels != nullptr), std::format("[VkImage] Failed to load image from '{0}'", imagePath.string()));
 
-        m_ImageSpecification.Width = static_cast<uint32_t>(width);
-        m_ImageSpecification.Height = static_cast<uint32_t>(height);
-        if (m_ImageSpecification.MipMaps)
-            m_Miplevels = static_cast<uint32_t>(std::floor(std::log2(std::max(width, height)))) + 1;
+        specs.Width = static_cast<uint32_t>(width);
+        specs.Height = static_cast<uint32_t>(height);
+        if (specs.MipMaps)
+            miplevels = static_cast<uint32_t>(std::floor(std::log2(std::max(width, height)))) + 1;
 
-        m_ImageSpecification.Format = ImageFormat::RGBA;
-        size_t imageSize = static_cast<size_t>(m_ImageSpecification.Width) * m_ImageSpecification.Height * 4ull;
+        specs.Format = ImageFormat::RGBA;
+        size_t imageSize = static_cast<size_t>(specs.Width) * specs.Height * 4ull;
 
-        m_Allocation = VulkanAllocator::AllocateImage(VMA_MEMORY_USAGE_GPU_ONLY, m_Image, m_ImageSpecification.Width, m_ImageSpecification.Height, m_Miplevels, ImageFormatToVkFormat(m_ImageSpecification.Format), VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | ImageUsageToVkImageUsage(m_ImageSpecification.Usage));
-        m_ImageView = VulkanAllocator::CreateImageView(m_Image, ImageFormatToVkFormat(m_ImageSpecification.Format), VK_IMAGE_ASPECT_COLOR_BIT, m_Miplevels);
-        m_Sampler = VulkanAllocator::CreateSampler(FilterModeToVkFilter(m_SamplerSpecification.MagFilter), FilterModeToVkFilter(m_SamplerSpecification.MinFilter), AddressModeToVkSamplerAddressMode(m_SamplerSpecification.Address), MipmapModeToVkSamplerMipmapMode(m_SamplerSpecification.Mipmaps), m_Miplevels);
+        s_Pool.Get<ImageColumn::Allocation>(m_Handle) = VulkanAllocator::AllocateImage(VMA_MEMORY_USAGE_GPU_ONLY, image, specs.Width, specs.Height, miplevels, ImageFormatToVkFormat(specs.Format), VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | ImageUsageToVkImageUsage(specs.Usage));
+        s_Pool.Get<ImageColumn::ImageView>(m_Handle) = VulkanAllocator::CreateImageView(image, ImageFormatToVkFormat(specs.Format), VK_IMAGE_ASPECT_COLOR_BIT, miplevels);
+        s_Pool.Get<ImageColumn::Sampler>(m_Handle) = VulkanAllocator::CreateSampler(FilterModeToVkFilter(m_SamplerSpecification.MagFilter), FilterModeToVkFilter(m_SamplerSpecification.MinFilter), AddressModeToVkSamplerAddressMode(m_SamplerSpecification.Address), MipmapModeToVkSamplerMipmapMode(m_SamplerSpecification.Mipmaps), miplevels);
+        VulkanRenderer::GetRenderer().GetDefragmenter().Register(m_Handle);
 
         Transition(cmd, ImageLayout::Undefined, ImageLayout::TransferDst);
 
@@ -141,6 +159,7 @@ namespace Lumen::Internal
             barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
 
             vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+            FrameStatistics::AddBarriers();
 
             VkImageBlit blit = {};
             blit.srcOffsets[0] = { 0, 0, 0 };
@@ -164,6 +183,7 @@ namespace Lumen::Internal
             barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
             vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+            FrameStatistics::AddBarriers();
 
             if (mipWidth > 1) mipWidth /= 2;
             if (mipHeight > 1) mipHeight /= 2;
@@ -178,11 +198,27 @@ namespace Lumen::Internal
         barrier.dstAccessMask = newBarrier.dstAccessMask;;
 
         vkCmdPipelineBarrier(commandBuffer, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+        FrameStatistics::AddBarriers();
     }
 
     void VulkanImage::DestroyImage()
     {
-        VulkanRenderer::GetRenderer().GetGarbageCollector().Collect(ImageGarbageEntry(m_Image, m_Allocation, m_ImageView, m_Sampler));
+        VulkanRenderer& renderer = VulkanRenderer::GetRenderer();
+
+        VkImage& image = s_Pool.Get<ImageColumn::Image>(m_Handle);
+        VmaAllocation& allocation = s_Pool.Get<ImageColumn::Allocation>(m_Handle);
+        VkImageView& imageView = s_Pool.Get<ImageColumn::ImageView>(m_Handle);
+        VkSampler& sampler = s_Pool.Get<ImageColumn::Sampler>(m_Handle);
+
+        // Note: During a defragmentation run the defragmenter takes the handles & allocation and collects them once the run has ended
+        if (!allocation || !renderer.GetDefragmenter().Unregister(m_Handle)) [[likely]]
+            renderer.GetGarbageCollector().Collect(ImageGarbageEntry(image, allocation, imageView, sampler));
+
+        // Note: The slot is kept by Resize, so it must not point at collected handles
+        image = VK_NULL_HANDLE;
+        allocation = VK_NULL_HANDLE;
+        imageView = VK_NULL_HANDLE;
+        sampler = VK_NULL_HANDLE;
     }
 
     void VulkanImage::SetData(const CommandBuffer& cmd, void* data, size_t size, ImageLayout desiredLayout)
@@ -190,12 +226,14 @@ namespace Lumen::Internal
         VulkanStagingBuffer& stagingBuffer = VulkanRenderer::GetRenderer().GetStagingBuffers().GetBuffer(size);
         stagingBuffer.SetData(data, size);
 
-        Transition(cmd, m_ImageSpecification.Layout, ImageLayout::TransferDst);
-        VulkanAllocator::CopyBufferToImage(cmd.GetInternalCommandBuffer().GetVkCommandBuffer(), stagingBuffer.Buffer, m_Image, m_ImageSpecification.Width, m_ImageSpecification.Height);
+        const ImageSpecification& specs = GetSpecification();
+
+        Transition(cmd, specs.Layout, ImageLayout::TransferDst);
+        VulkanAllocator::CopyBufferToImage(cmd.GetInternalCommandBuffer().GetVkCommandBuffer(), stagingBuffer.Buffer, GetVkImage(), specs.Width, specs.Height);
 
-        if (m_ImageSpecification.MipMaps)
+        if (specs.MipMaps)
         {
-            GenerateMipmaps(cmd, m_Image, ImageFormatToVkFormat(m_ImageSpecification.Format), ImageLayoutToVkImageLayout(desiredLayout), m_ImageSpecification.Width, m_ImageSpecification.Height, m_Miplevels);
+            GenerateMipmaps(cmd, s_Pool.Get<ImageColumn::Image>(m_Handle), ImageFormatToVkFormat(specs.Format), ImageLayoutToVkImageLayout(desiredLayout), specs.Width, specs.Height, GetMiplevels());
         }
         else
         {
@@ -215,7 +253,7 @@ namespace Lumen::Internal
         barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
 
-        barrier.image = m_Image;
+        barrier.image = GetVkImage();
         barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         barrier.subresourceRange.baseMipLevel = 0;
         barrier.subresourceRange.levelCount = mipLevels;
@@ -226,12 +264,12 @@ namespace Lumen::Internal
         VkPipelineStageFlags destinationStage = 0;
 
         // Aspect checks
-        if (VkFormatIsDepth(ImageFormatToVkFormat(m_ImageSpecification.Format)))
+        if (VkFormatIsDepth(ImageFormatToVkFormat(GetSpecification().Format)))
         {
             barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
 
             // Check if it has stencil component
-            if (VkFormatHasStencil(ImageFormatToVkFormat(m_ImageSpecification.Format)))
+            if (VkFormatHasStencil(ImageFormatToVkFormat(GetSpecification().Format)))
                 barrier.subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
         }
 
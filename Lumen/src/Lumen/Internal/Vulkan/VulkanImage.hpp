@@ -7,6 +7,8 @@
 
 #include "Lumen/Internal/Enum/Bitwise.hpp"
 
+#include "Lumen/Internal/Memory/HandlePool.hpp"
+
 #include <tuple>
 #include <filesystem>
 
@@ -14,6 +16,15 @@ namespace Lumen::Internal
 {
 
     class CommandBuffer;
+    class VulkanImage;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Handles
+    ////////////////////////////////////////////////////////////////////////////////////
+    enum class ImageColumn : uint8_t { Image = 0, Allocation, ImageView, Sampler, Specification, Miplevels };
+
+    using ImageHandle = Handle<VulkanImage>;
+    using VulkanImagePool = HandlePool<VulkanImage, VkImage, VmaAllocation, VkImageView, VkSampler, ImageSpecification, uint32_t>; // Note: Columns in the order of ImageColumn
 
     ////////////////////////////////////////////////////////////////////////////////////
     // Convert functions
@@ -37,10 +48,12 @@ namespace Lumen::Internal
     constexpr bool VkFormatIsDepth(VkFormat format);
     constexpr bool VkFormatHasStencil(VkFormat format);
 
+    constexpr uint32_t VkFormatToPixelSize(VkFormat format);
+
     ////////////////////////////////////////////////////////////////////////////////////
     // VulkanImage
     ////////////////////////////////////////////////////////////////////////////////////
-    class VulkanImage
+    class VulkanImage // Note: Owns a slot in the image pool, everyone else (the defragmenter, garbage, etc.) refers to it by handle
     {
     public:
         // Constructors & Destructor
@@ -49,25 +62,37 @@ namespace Lumen::Internal
         VulkanImage(const ImageSpecification& imageSpecs, VkImage image, VkImageView imageView); // Note: This exists for swapchain images
         ~VulkanImage();
 
+        // Copy/Move constructors
+        VulkanImage(const VulkanImage&) = delete;
+        VulkanImage(VulkanImage&&) = delete;
+        VulkanImage& operator = (const VulkanImage&) = delete;
+        VulkanImage& operator = (VulkanImage&&) = delete;
+
         // Methods
         void SetData(const CommandBuffer& cmd, void* data, size_t size);
 
-        void Resize(const CommandBuffer& cmd, uint32_t width, uint32_t height);
+        void Resize(const CommandBuffer& cmd, uint32_t width, uint32_t height); // Note: Keeps the handle
 
         void Transition(const CommandBuffer& cmd, ImageLayout initial, ImageLayout final);
 
         // Getters
-        forceinline const ImageSpecification& GetSpecification() const { return m_ImageSpecification; }
+        forceinline const ImageSpecification& GetSpecification() const { return s_Pool.Get<ImageColumn::Specification>(m_Handle); }
         forceinline const SamplerSpecification& GetSamplerSpecification() const { return m_SamplerSpecification; }
 
-        forceinline uint32_t GetWidth() const { return m_ImageSpecification.Width; }
-        forceinline uint32_t GetHeight() const { return m_ImageSpecification.Height; }
+        forceinline uint32_t GetWidth() const { return GetSpecification().Width; }
+        forceinline uint32_t GetHeight() const { return GetSpecification().Height; }
 
         // Internal getters
-        forceinline VkImage GetVkImage() const { return m_Image; }
-        forceinline VmaAllocation GetVmaAllocation() const { return m_Allocation; }
-        forceinline VkImageView GetVkImageView() const { return m_ImageView; }
-        forceinline VkSampler GetVkSampler() const { return m_Sampler; }
+        forceinline ImageHandle GetHandle() const { return m_Handle; }
+
+        forceinline VkImage GetVkImage() const { return s_Pool.Get<ImageColumn::Image>(m_Handle); }
+        forceinline VmaAllocation GetVmaAllocation() const { return s_Pool.Get<ImageColumn::Allocation>(m_Handle); }
+        forceinline VkImageView GetVkImageView() const { return s_Pool.Get<ImageColumn::ImageView>(m_Handle); }
+        forceinline VkSampler GetVkSampler() const { return s_Pool.Get<ImageColumn::Sampler>(m_Handle); }
+        forceinline uint32_t GetMiplevels() const { return s_Pool.Get<ImageColumn::Miplevels>(m_Handle); }
+
+        // Static methods
+        forceinline static VulkanImagePool& GetPool() { return s_Pool; }
 
     private:
         // Create & Destroy
@@ -81,15 +106,10 @@ namespace Lumen::Internal
         std::tuple<VkPipelineStageFlags, VkPipelineStageFlags, VkImageMemoryBarrier> GetImageBarrier(VkImageLayout src, VkImageLayout dst, uint32_t mipLevels) const;
 
     private:
-        VkImage m_Image = VK_NULL_HANDLE;
-        VmaAllocation m_Allocation = VK_NULL_HANDLE;
-        VkImageView m_ImageView = VK_NULL_HANDLE;
-        VkSampler m_Sampler = VK_NULL_HANDLE;
-
-        ImageSpecification m_ImageSpecification;
+        ImageHandle m_Handle = {};
         SamplerSpecification m_SamplerSpecification;
 
-        uint32_t m_Miplevels = 1;
+        inline static VulkanImagePool s_Pool = {};
     };
 
 }
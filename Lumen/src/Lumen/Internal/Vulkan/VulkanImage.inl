@@ -6,37 +6,38 @@ namespace Lumen::Internal
 	// Constructor & Destructor
 	////////////////////////////////////////////////////////////////////////////////////
 	hintinline VulkanImage::VulkanImage(const CommandBuffer& initCmd, const ImageSpecification& imageSpecs, const SamplerSpecification& samplerSpecs)
-		: m_ImageSpecification(imageSpecs), m_SamplerSpecification(samplerSpecs)
+		: m_Handle(s_Pool.Create(VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, imageSpecs, 1)), m_SamplerSpecification(samplerSpecs)
 	{
-		LU_ASSERT((static_cast<bool>(m_ImageSpecification.Usage & ImageUsage::Colour) || static_cast<bool>(m_ImageSpecification.Usage & ImageUsage::DepthStencil)), "[VulkanImage] Tried to create image without specifying if it's a Colour or Depth image.");
+		LU_ASSERT((static_cast<bool>(imageSpecs.Usage & ImageUsage::Colour) || static_cast<bool>(imageSpecs.Usage & ImageUsage::DepthStencil)), "[VulkanImage] Tried to create image without specifying if it's a Colour or Depth image.");
 
-		CreateImage(initCmd, m_ImageSpecification.Width, m_ImageSpecification.Height);
+		CreateImage(initCmd, imageSpecs.Width, imageSpecs.Height);
 	}
 
 	hintinline VulkanImage::VulkanImage(const CommandBuffer& initCmd, const ImageSpecification& imageSpecs, const SamplerSpecification& samplerSpecs, const std::filesystem::path& imagePath)
-		: m_ImageSpecification(imageSpecs), m_SamplerSpecification(samplerSpecs)
+		: m_Handle(s_Pool.Create(VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, imageSpecs, 1)), m_SamplerSpecification(samplerSpecs)
 	{
-		LU_ASSERT((static_cast<bool>(m_ImageSpecification.Usage & ImageUsage::Colour) || static_cast<bool>(m_ImageSpecification.Usage & ImageUsage::DepthStencil)), "[VulkanImage] Tried to create image without specifying if it's a Colour or Depth image.");
+		LU_ASSERT((static_cast<bool>(imageSpecs.Usage & ImageUsage::Colour) || static_cast<bool>(imageSpecs.Usage & ImageUsage::DepthStencil)), "[VulkanImage] Tried to create image without specifying if it's a Colour or Depth image.");
 
 		CreateImage(initCmd, imagePath);
 	}
 
 	hintinline VulkanImage::VulkanImage(const ImageSpecification& imageSpecs, VkImage image, VkImageView imageView)
-		: m_ImageSpecification(imageSpecs), m_SamplerSpecification({}), m_Image(image), m_ImageView(imageView)
+		: m_Handle(s_Pool.Create(image, VK_NULL_HANDLE, imageView, VK_NULL_HANDLE, imageSpecs, 1)), m_SamplerSpecification({})
 	{
 	}
 
 	hintinline VulkanImage::~VulkanImage()
 	{
 		DestroyImage();
+		s_Pool.Destroy(m_Handle);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
 	// Methods
 	////////////////////////////////////////////////////////////////////////////////////
-	void VulkanImage::SetData(const CommandBuffer& cmd, void* data, size_t size)
+	hintinline void VulkanImage::SetData(const CommandBuffer& cmd, void* data, size_t size)
 	{
-		SetData(cmd, data, size, m_ImageSpecification.Layout);
+		SetData(cmd, data, size, GetSpecification().Layout);
 	}
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -374,4 +375,38 @@ namespace Lumen::Internal
 		return false;
 	}
 
+	constexpr uint32_t VkFormatToPixelSize(VkFormat format) // Note: For depth/stencil formats this returns the size of a tightly packed depth aspect copy
+	{
+		switch (format)
+		{
+		case VK_FORMAT_S8_UINT:
+			return 1;
+
+		case VK_FORMAT_D16_UNORM:
+		case VK_FORMAT_D16_UNORM_S8_UINT:
+			return 2;
+
+		case VK_FORMAT_R8G8B8A8_UNORM:
+		case VK_FORMAT_R8G8B8A8_SRGB:
+		case VK_FORMAT_B8G8R8A8_UNORM:
+		case VK_FORMAT_B8G8R8A8_SRGB:
+		case VK_FORMAT_X8_D24_UNORM_PACK32:
+		case VK_FORMAT_D24_UNORM_S8_UINT:
+		case VK_FORMAT_D32_SFLOAT:
+		case VK_FORMAT_D32_SFLOAT_S8_UINT:
+		case VK_FORMAT_A2B10G10R10_UNORM_PACK32: // Note: Can be picked by the swapchain if the requested format isn't supported
+		case VK_FORMAT_A2R10G10B10_UNORM_PACK32:
+			return 4;
+
+		case VK_FORMAT_R16G16B16A16_SFLOAT:
+			return 8;
+
+		default:
+			LU_ASSERT(false, "[VulkanImage] Pixel size of format not implemented.");
+			break;
+		}
+
+		return 0;
+	}
+
 }
\ No newline at end of file
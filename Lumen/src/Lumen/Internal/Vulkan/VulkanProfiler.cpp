@@ -0,0 +1,63 @@
+#include "lupch.h"
+#include "VulkanProfiler.hpp"
+
+#include "Lumen/Internal/IO/Print.hpp"
+
+#include "Lumen/Internal/Vulkan/VulkanContext.hpp"
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Constructor & Destructor
+	////////////////////////////////////////////////////////////////////////////////////
+	VulkanProfiler::VulkanProfiler()
+	{
+		#if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING
+		VulkanDevice& device = VulkanContext::GetVulkanDevice();
+
+		// Note: The command buffer is only used to calibrate the GPU clock on creation, Tracy submits and waits on it itself
+		VkCommandPoolCreateInfo poolInfo = {};
+		poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+		poolInfo.queueFamilyIndex = device.GetQueueFamily();
+
+		VkCommandPool commandPool = VK_NULL_HANDLE;
+		VK_VERIFY(vkCreateCommandPool(device.GetVkDevice(), &poolInfo, nullptr, &commandPool));
+
+		VkCommandBufferAllocateInfo allocInfo = {};
+		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		allocInfo.commandPool = commandPool;
+		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		allocInfo.commandBufferCount = 1;
+
+		VkCommandBuffer cmd = VK_NULL_HANDLE;
+		VK_VERIFY(vkAllocateCommandBuffers(device.GetVkDevice(), &allocInfo, &cmd));
+
+		s_Context = TracyVkContext(VulkanContext::GetVulkanPhysicalDevice().GetVkPhysicalDevice(), device.GetVkDevice(), device.GetGraphicsQueue(), cmd);
+		TracyVkContextName(s_Context, "Graphics", 8);
+
+		// Note: Also frees the command buffer allocated from it
+		vkDestroyCommandPool(device.GetVkDevice(), commandPool, nullptr);
+		#endif
+	}
+
+	VulkanProfiler::~VulkanProfiler()
+	{
+		#if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING
+		TracyVkDestroy(s_Context);
+		s_Context = nullptr;
+		#endif
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanProfiler::Collect([[maybe_unused]] VkCommandBuffer cmd)
+	{
+		#if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING
+		TracyVkCollect(s_Context, cmd);
+		#endif
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Lumen/Internal/Utils/Profiler.hpp"
+
+#include "Lumen/Internal/Vulkan/Vulkan.hpp"
+
+#include "Lumen/Core/Core.hpp"
+
+#include <tracy/TracyVulkan.hpp>
+
+#include <cstdint>
+
+namespace Lumen::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanProfiler
+    ////////////////////////////////////////////////////////////////////////////////////
+    class VulkanProfiler // Note: Owns the Tracy GPU context of the graphics queue, does nothing if profiling is disabled
+    {
+    public:
+        // Constructor & Destructor
+        VulkanProfiler();
+        ~VulkanProfiler();
+
+        // Methods
+        void Collect(VkCommandBuffer cmd); // Note: Call once per frame outside of a renderpass, reads back the timestamps of finished frames
+
+        // Static methods
+        forceinline static TracyVkCtx GetContext() { return s_Context; }
+
+    private:
+        inline static TracyVkCtx s_Context = nullptr;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Macros
+    ////////////////////////////////////////////////////////////////////////////////////
+    #if !defined(LU_CONFIG_DIST) && LU_ENABLE_PROFILING
+        #define LU_PROFILE_GPU(cmd, name) TracyVkZone(::Lumen::Internal::VulkanProfiler::GetContext(), cmd, name)
+    #else
+        #define LU_PROFILE_GPU(cmd, name)
+    #endif
+
+}
\ No newline at end of file
@@ -0,0 +1,278 @@
+#include "lupch.h"
+#include "VulkanReadback.hpp"
+
+#include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Utils/Profiler.hpp"
+#include "Lumen/Internal/Utils/FrameStatistics.hpp"
+
+#include "Lumen/Internal/Vulkan/VulkanImage.hpp"
+#include "Lumen/Internal/Vulkan/VulkanContext.hpp"
+#include "Lumen/Internal/Vulkan/VulkanProfiler.hpp"
+
+namespace Lumen::Internal
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Constructor & Destructor
+	////////////////////////////////////////////////////////////////////////////////////
+	VulkanReadbackRing::VulkanReadbackRing(uint32_t slots)
+		: m_SlotCount(slots)
+	{
+		LU_ASSERT(((slots > 0) && (slots <= MaxSlots)), std::format("[VkReadbackRing] Slot count must be between 1 and {0}.", MaxSlots));
+
+		VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+		VkCommandPoolCreateInfo poolInfo = {};
+		poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+		poolInfo.queueFamilyIndex = VulkanContext::GetVulkanDevice().GetQueueFamily();
+
+		VK_VERIFY(vkCreateCommandPool(device, &poolInfo, nullptr, &m_CommandPool));
+
+		Array<VkCommandBuffer, MaxSlots> commandBuffers = { };
+
+		VkCommandBufferAllocateInfo allocInfo = {};
+		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		allocInfo.commandPool = m_CommandPool;
+		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		allocInfo.commandBufferCount = m_SlotCount;
+
+		VK_VERIFY(vkAllocateCommandBuffers(device, &allocInfo, commandBuffers.data()));
+
+		VkFenceCreateInfo fenceInfo = {};
+		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		fenceInfo.flags = 0;
+
+		for (uint32_t i = 0; i < m_SlotCount; i++)
+		{
+			m_Slots[i].CommandBuffer = commandBuffers[i];
+			VK_VERIFY(vkCreateFence(device, &fenceInfo, nullptr, &m_Slots[i].Fence));
+		}
+	}
+
+	VulkanReadbackRing::~VulkanReadbackRing()
+	{
+		Flush();
+
+		VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+		for (uint32_t i = 0; i < m_SlotCount; i++)
+		{
+			Release(m_Slots[i]);
+			vkDestroyFence(device, m_Slots[i].Fence, nullptr);
+		}
+
+		// Note: Also frees all command buffers allocated from it
+		vkDestroyCommandPool(device, m_CommandPool, nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	uint64_t VulkanReadbackRing::Enqueue(VulkanImage& image)
+	{
+		LU_PROFILE("VkReadbackRing::Enqueue()");
+
+		if (m_Occupied == m_SlotCount) [[unlikely]]
+			return 0;
+
+		Slot& slot = m_Slots[m_Head];
+		Record(slot, image);
+
+		VkSubmitInfo submitInfo = {};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &slot.CommandBuffer;
+
+		VK_VERIFY(vkQueueSubmit(VulkanContext::GetVulkanDevice().GetGraphicsQueue(), 1, &submitInfo, slot.Fence));
+		FrameStatistics::AddSubmits();
+
+		slot.State = SlotState::Pending;
+		slot.Result.ID = m_NextID++;
+
+		m_Head = (m_Head + 1) % m_SlotCount;
+		m_Occupied++;
+
+		return slot.Result.ID;
+	}
+
+	std::optional<VulkanReadbackResult> VulkanReadbackRing::Poll(bool wait)
+	{
+		LU_PROFILE("VkReadbackRing::Poll()");
+
+		if (m_Occupied == 0)
+			return std::nullopt;
+
+		VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+		Slot& slot = m_Slots[m_Tail];
+
+		if (slot.State == SlotState::Pending)
+		{
+			if (!wait && vkGetFenceStatus(device, slot.Fence) == VK_NOT_READY)
+				return std::nullopt;
+
+			if (wait)
+			{
+				VK_VERIFY(vkWaitForFences(device, 1, &slot.Fence, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+			}
+
+			VulkanAllocator::InvalidateMemory(slot.Allocation, slot.Result.Data.size());
+		}
+
+		// Note: The memory stays mapped, so the span remains valid until this slot gets recorded into again
+		slot.State = SlotState::Free;
+		m_Tail = (m_Tail + 1) % m_SlotCount;
+		m_Occupied--;
+
+		return slot.Result;
+	}
+
+	void VulkanReadbackRing::Flush()
+	{
+		LU_PROFILE("VkReadbackRing::Flush()");
+
+		VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+
+		Array<VkFence, MaxSlots> fences = { };
+		uint32_t fenceCount = 0;
+
+		for (uint32_t i = 0; i < m_SlotCount; i++)
+		{
+			if (m_Slots[i].State == SlotState::Pending)
+				fences[fenceCount++] = m_Slots[i].Fence;
+		}
+
+		if (fenceCount == 0)
+			return;
+
+		VK_VERIFY(vkWaitForFences(device, fenceCount, fences.data(), VK_TRUE, std::numeric_limits<uint64_t>::max()));
+
+		for (uint32_t i = 0; i < m_SlotCount; i++)
+		{
+			Slot& slot = m_Slots[i];
+			if (slot.State != SlotState::Pending)
+				continue;
+
+			VulkanAllocator::InvalidateMemory(slot.Allocation, slot.Result.Data.size());
+			slot.State = SlotState::Ready;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanReadbackRing::Reserve(Slot& slot, size_t size)
+	{
+		if (slot.Capacity >= size) [[likely]]
+			return;
+
+		// Note: A free slot's fence has been waited on (or never submitted), so the old buffer can be destroyed right away
+		Release(slot);
+
+		slot.Allocation = VulkanAllocator::AllocateBuffer(VMA_MEMORY_USAGE_GPU_TO_CPU, slot.Buffer, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, MemoryCategory::Staging, AllocationPolicy::Default); // Note: Not the staging pool, readbacks prefer host cached memory
+		VulkanAllocator::MapMemory(slot.Allocation, slot.Mapped);
+
+		slot.Capacity = size;
+	}
+
+	void VulkanReadbackRing::Release(Slot& slot)
+	{
+		if (slot.Buffer == VK_NULL_HANDLE)
+			return;
+
+		VulkanAllocator::UnMapMemory(slot.Allocation);
+		VulkanAllocator::DestroyBuffer(slot.Buffer, slot.Allocation);
+
+		slot.Buffer = VK_NULL_HANDLE;
+		slot.Allocation = VK_NULL_HANDLE;
+		slot.Mapped = nullptr;
+		slot.Capacity = 0;
+	}
+
+	void VulkanReadbackRing::Record(Slot& slot, VulkanImage& image)
+	{
+		const ImageSpecification& specs = image.GetSpecification();
+		VkFormat format = ImageFormatToVkFormat(specs.Format);
+		VkImageLayout layout = ImageLayoutToVkImageLayout(specs.Layout);
+
+		LU_ASSERT((VkFormatToVkImageAspectFlags(format) == VK_IMAGE_ASPECT_COLOR_BIT), "[VkReadbackRing] Only colour images can be read back.");
+		LU_ASSERT((specs.Layout != ImageLayout::Undefined), "[VkReadbackRing] Tried to read back an image without defined contents.");
+
+		size_t size = static_cast<size_t>(specs.Width) * specs.Height * VkFormatToPixelSize(format);
+		Reserve(slot, size);
+
+		slot.Result.Width = specs.Width;
+		slot.Result.Height = specs.Height;
+		slot.Result.Data = std::span<const uint8_t>(static_cast<const uint8_t*>(slot.Mapped), size);
+
+		VK_VERIFY(vkResetFences(VulkanContext::GetVulkanDevice().GetVkDevice(), 1, &slot.Fence));
+		VK_VERIFY(vkResetCommandBuffer(slot.CommandBuffer, 0));
+
+		VkCommandBufferBeginInfo beginInfo = {};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+		VK_VERIFY(vkBeginCommandBuffer(slot.CommandBuffer, &beginInfo));
+
+		{
+			LU_PROFILE_GPU(slot.CommandBuffer, "VkReadbackRing::Record()");
+
+			VkImageMemoryBarrier imageBarrier = {};
+			imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			imageBarrier.image = image.GetVkImage();
+			imageBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			imageBarrier.subresourceRange.baseMipLevel = 0;
+			imageBarrier.subresourceRange.levelCount = 1;
+			imageBarrier.subresourceRange.baseArrayLayer = 0;
+			imageBarrier.subresourceRange.layerCount = 1;
+
+			// To transfer source, after whatever wrote to the image last
+			imageBarrier.oldLayout = layout;
+			imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+			imageBarrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+			imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+			vkCmdPipelineBarrier(slot.CommandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+			FrameStatistics::AddBarriers();
+
+			VkBufferImageCopy region = {};
+			region.bufferOffset = 0;
+			region.bufferRowLength = 0;
+			region.bufferImageHeight = 0;
+			region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			region.imageSubresource.mipLevel = 0;
+			region.imageSubresource.baseArrayLayer = 0;
+			region.imageSubresource.layerCount = 1;
+			region.imageOffset = { 0, 0, 0 };
+			region.imageExtent = { specs.Width, specs.Height, 1 };
+
+			vkCmdCopyImageToBuffer(slot.CommandBuffer, image.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot.Buffer, 1, &region);
+
+			// Back to the layout the image is tracked in
+			imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+			imageBarrier.newLayout = layout;
+			imageBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+			imageBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+			// Make the copied data visible to the host
+			VkBufferMemoryBarrier bufferBarrier = {};
+			bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+			bufferBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			bufferBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+			bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			bufferBarrier.buffer = slot.Buffer;
+			bufferBarrier.offset = 0;
+			bufferBarrier.size = static_cast<VkDeviceSize>(size);
+
+			vkCmdPipelineBarrier(slot.CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+			vkCmdPipelineBarrier(slot.CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &bufferBarrier, 0, nullptr);
+			FrameStatistics::AddBarriers(2);
+		}
+
+		VK_VERIFY(vkEndCommandBuffer(slot.CommandBuffer));
+	}
+
+}
\ No newline at end of file
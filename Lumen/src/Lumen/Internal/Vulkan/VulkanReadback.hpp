@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Lumen/Internal/Memory/Array.hpp"
+
+#include "Lumen/Internal/Renderer/RendererSpec.hpp"
+
+#include "Lumen/Internal/Vulkan/Vulkan.hpp"
+
+#include "Lumen/Core/Core.hpp"
+
+#include <cstdint>
+#include <span>
+#include <optional>
+
+namespace Lumen::Internal
+{
+
+    class VulkanImage;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanReadbackResult
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct VulkanReadbackResult
+    {
+    public:
+        uint64_t ID = 0;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+
+        std::span<const uint8_t> Data = { }; // Note: Points directly into persistently mapped memory, only valid until the next call to Enqueue()
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanReadbackRing
+    ////////////////////////////////////////////////////////////////////////////////////
+    class VulkanReadbackRing // Note: Owns its own command pool and fences, so it has no dependency on the swapchain
+    {
+    public:
+        inline static constexpr const uint32_t MaxSlots = 8;
+    public:
+        // Constructor & Destructor
+        VulkanReadbackRing(uint32_t slots = RendererSpecification::DefaultFramesInFlight);
+        ~VulkanReadbackRing();
+
+        // Methods
+        uint64_t Enqueue(VulkanImage& image); // Note: Returns 0 if all slots are occupied, Poll() to free up a slot
+        std::optional<VulkanReadbackResult> Poll(bool wait = false); // Note: Returns the oldest finished readback, only blocks (on the slot's fence) if wait is true
+
+        void Flush(); // Note: Waits for all pending copies to finish, without idling the queue
+
+        // Getters
+        forceinline uint32_t GetSlotCount() const { return m_SlotCount; }
+        forceinline uint32_t GetOccupiedCount() const { return m_Occupied; }
+
+    private:
+        enum class SlotState : uint8_t { Free = 0, Pending, Ready };
+
+        struct Slot
+        {
+        public:
+            VkBuffer Buffer = VK_NULL_HANDLE;
+            VmaAllocation Allocation = VK_NULL_HANDLE;
+            void* Mapped = nullptr;
+            size_t Capacity = 0;
+
+            VkCommandBuffer CommandBuffer = VK_NULL_HANDLE;
+            VkFence Fence = VK_NULL_HANDLE;
+
+            SlotState State = SlotState::Free;
+            VulkanReadbackResult Result = {};
+        };
+
+    private:
+        // Private methods
+        void Reserve(Slot& slot, size_t size);
+        void Release(Slot& slot);
+
+        void Record(Slot& slot, VulkanImage& image);
+
+    private:
+        VkCommandPool m_CommandPool = VK_NULL_HANDLE;
+        Array<Slot, MaxSlots> m_Slots = { };
+
+        uint32_t m_SlotCount;
+        uint32_t m_Head = 0; // Next slot to record into
+        uint32_t m_Tail = 0; // Oldest occupied slot
+        uint32_t m_Occupied = 0;
+
+        uint64_t m_NextID = 1;
+    };
+
+}
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "VulkanRenderer.hpp"
 
 #include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/Utils/Profiler.hpp"
+#include "Lumen/Internal/Utils/FrameStatistics.hpp"
 
 #include "Lumen/Internal/Core/Window.hpp"
 
@@ -20,6 +22,8 @@ namespace Lumen::Internal
 	VulkanRenderer::VulkanRenderer(const RendererSpecification& specs)
 		: m_Specification(specs)
 	{
+		LU_MEM_TAG(Renderer);
+
 		s_Renderer = this;
 
 		//m_TaskManager.Init();
@@ -32,7 +36,7 @@ namespace Lumen::Internal
 		InitCommandPool(surface);
 
 		// Note: We pass ownership of the surface to the swapchain
-		//m_SwapChain.Init(specs.WindowRef);
+		m_SwapChain.Construct(specs.WindowRef, surface, specs.Format, specs.Latency, specs.FramesInFlight);
 	}
 
 	VulkanRenderer::~VulkanRenderer()
@@ -43,9 +47,9 @@ namespace Lumen::Internal
 
 		vkDestroyCommandPool(device.GetVkDevice(), m_CommandPool, nullptr);
 
-		m_GarbageCollector.Dispose();
-		//m_SwapChain.Destroy();
-		m_GarbageCollector.Dispose();
+		m_GarbageCollector.DisposeAll();
+		m_SwapChain.Destroy();
+		m_GarbageCollector.DisposeAll();
 
 		s_Renderer = nullptr;
 	}
@@ -55,15 +59,64 @@ namespace Lumen::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	void VulkanRenderer::BeginFrame()
 	{
+		LU_MEM_TAG(Renderer);
+
+		// Note: Before the swapchain, since it reads back the GPU times of earlier frames
+		FrameStatistics::NextFrame();
+
+		m_SwapChain->WaitForFrame();
+
+		// Note: The swapchain waited on this frame's fence, so last use of its transient data is done
+		m_Synchronizer.ResetFrame(static_cast<uint8_t>(m_SwapChain->GetCurrentFrame()));
+
+		// Note: Before the swapchain acquires, a recreate retires the old swapchain & views into this frame's garbage,
+		//       which must survive until the other frames in flight (that may still present it) have finished
 		m_GarbageCollector.Dispose();
+		m_SwapChain->BeginFrame();
+
+		m_StagingBuffers.RetireUsed();
+
+		VulkanAllocator::NextFrame();
+		m_Defragmenter.Step();
 	}
 
 	void VulkanRenderer::EndFrame()
 	{
+		LU_MEM_TAG(Renderer);
+
+		m_SwapChain->EndFrame();
 	}
 
 	void VulkanRenderer::Present()
 	{
+		LU_MEM_TAG(Renderer);
+
+		m_SwapChain->Present();
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Object methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanRenderer::Begin(CommandBuffer& cmdBuf, const char* name)
+	{
+		VulkanCommandBuffer& cmd = cmdBuf.GetInternalCommandBuffer();
+
+		VkCommandBufferBeginInfo beginInfo = {};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+		VK_VERIFY(vkBeginCommandBuffer(cmd.GetVkCommandBuffer(), &beginInfo));
+
+		// Note: Brackets everything recorded, so each FrameGraph element shows up as a GPU zone
+		cmd.BeginZone(name);
+	}
+
+	void VulkanRenderer::End(CommandBuffer& cmdBuf)
+	{
+		VulkanCommandBuffer& cmd = cmdBuf.GetInternalCommandBuffer();
+		cmd.EndZone();
+
+		VK_VERIFY(vkEndCommandBuffer(cmd.GetVkCommandBuffer()));
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -71,8 +124,35 @@ namespace Lumen::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	void VulkanRenderer::Recreate(uint32_t width, uint32_t height, bool vsync)
 	{
-		// TODO: ...
-		//m_SwapChain->Resize();
+		m_Specification.Width = width;
+		m_Specification.Height = height;
+		m_Specification.VSync = vsync;
+
+		m_SwapChain->Resize(width, height, vsync);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Setters
+	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanRenderer::SetFramesInFlight(uint8_t frames)
+	{
+		// Note: The swapchain doesn't wait for the device if nothing changes, so the garbage below may still be in use
+		if (frames == m_SwapChain->GetFramesInFlight())
+			return;
+
+		m_Specification.FramesInFlight = frames;
+		m_SwapChain->SetFramesInFlight(frames);
+
+		// Note: Garbage & buffers in use are bucketed by the old frame slots, the device is idle at this point
+		m_GarbageCollector.DisposeAll();
+		m_StagingBuffers.RetireAll();
+		m_Synchronizer.ResetAll();
+	}
+
+	void VulkanRenderer::SetLatencyMode(LatencyMode mode)
+	{
+		m_Specification.Latency = mode;
+		m_SwapChain->SetLatencyMode(mode);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
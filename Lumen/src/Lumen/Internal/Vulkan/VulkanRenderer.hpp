@@ -10,9 +10,11 @@
 
 #include "Lumen/Internal/Vulkan/VulkanBuffers.hpp"
 
-//#include "Lumen/Internal/Vulkan/VulkanSwapChain.hpp"
+#include "Lumen/Internal/Vulkan/VulkanSwapChain.hpp"
 #include "Lumen/Internal/Vulkan/VulkanSynchronizer.hpp"
 #include "Lumen/Internal/Vulkan/VulkanGarbageCollector.hpp"
+#include "Lumen/Internal/Vulkan/VulkanDefragmenter.hpp"
+#include "Lumen/Internal/Vulkan/VulkanProfiler.hpp"
 
 #include <cstdint>
 #include <queue>
@@ -37,9 +39,9 @@ namespace Lumen::Internal
         void Present();
 
         // Object methods
-        //void Begin(CommandBuffer& cmdBuf);
+        void Begin(CommandBuffer& cmdBuf, const char* name = "CommandBuffer"); // Note: The name labels the command buffer's GPU zone in the profiler
         //void Begin(Renderpass& renderpass);
-        //void End(CommandBuffer& cmdBuf);
+        void End(CommandBuffer& cmdBuf);
         //void End(Renderpass& renderpass);
         //void Submit(CommandBuffer& cmdBuf, ExecutionPolicy policy, Queue queue, PipelineStage waitStage, const std::vector<CommandBuffer*>& waitOn);
         //void Submit(Renderpass& renderpass, ExecutionPolicy policy, Queue queue, PipelineStage waitStage, const std::vector<CommandBuffer*>& waitOn);
@@ -58,8 +60,14 @@ namespace Lumen::Internal
         // Internal
         void Recreate(uint32_t width, uint32_t height, bool vsync);
 
+        // Setters
+        void SetFramesInFlight(uint8_t frames); // Note: Waits for the device to be idle
+        void SetLatencyMode(LatencyMode mode);
+
         // Getters
         forceinline const RendererSpecification& GetSpecification() const { return m_Specification; }
+        forceinline const VulkanLatencyStatistics& GetLatencyStatistics() const { return m_SwapChain->GetLatencyStatistics(); }
+        forceinline LinearArena& GetFrameArena() { return m_Synchronizer.GetFrameArena(); } // Note: Reset every BeginFrame, for data that only lives until the frame is done
 
         //ImageFormat GetColourFormat() const;
         //ImageFormat GetDepthFormat() const;
@@ -68,7 +76,9 @@ namespace Lumen::Internal
         // Internal getters
         forceinline VulkanGarbageCollector& GetGarbageCollector() { return m_GarbageCollector; }
         forceinline VulkanSynchronizer& GetSynchronizer() { return m_Synchronizer; }
-        //inline VulkanSwapChain& GetVulkanSwapChain() { return m_SwapChain; }
+        forceinline VulkanDefragmenter& GetDefragmenter() { return m_Defragmenter; }
+        forceinline VulkanProfiler& GetProfiler() { return m_Profiler; }
+        forceinline VulkanSwapChain& GetVulkanSwapChain() { return m_SwapChain; }
         forceinline VulkanStagingBufferRegistry& GetStagingBuffers() { return m_StagingBuffers; }
 
         forceinline VkCommandPool GetVkCommandPool() const { return m_CommandPool; }
@@ -84,7 +94,7 @@ namespace Lumen::Internal
         void InitCommandPool(VkSurfaceKHR surface);
 
     private:
-        //VulkanSwapChain m_SwapChain = {};
+        DeferredConstruct<VulkanSwapChain, true> m_SwapChain = {};
         VulkanGarbageCollector m_GarbageCollector = {};
         VulkanSynchronizer m_Synchronizer = {};
 
@@ -92,6 +102,8 @@ namespace Lumen::Internal
         
         VkCommandPool m_CommandPool = VK_NULL_HANDLE;
         VulkanStagingBufferRegistry m_StagingBuffers = {};
+        VulkanDefragmenter m_Defragmenter = {};
+        VulkanProfiler m_Profiler = {};
 
         inline static VulkanRenderer* s_Renderer = nullptr;
     };
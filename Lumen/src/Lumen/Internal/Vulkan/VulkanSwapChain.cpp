@@ -3,10 +3,14 @@
 
 #include "Lumen/Internal/IO/Print.hpp"
 #include "Lumen/Internal/Utils/Profiler.hpp"
+#include "Lumen/Internal/Utils/FrameStatistics.hpp"
 
 #include "Lumen/Internal/Core/Window.hpp"
 
+#include "Lumen/Internal/Memory/SmallVector.hpp"
+
 #include "Lumen/Internal/Vulkan/VulkanContext.hpp"
+#include "Lumen/Internal/Vulkan/VulkanRenderer.hpp"
 #include "Lumen/Internal/Vulkan/VulkanCommandBuffer.hpp"
 
 #if defined(LU_PLATFORM_DESKTOP)
@@ -14,26 +18,95 @@
 	#include <GLFW/glfw3.h>
 #endif
 
+namespace
+{
+
+	static double GetTime() // Note: In milliseconds
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+}
+
 namespace Lumen::Internal
 {
 
 	////////////////////////////////////////////////////////////////////////////////////
 	// Constructor & Destructor
 	////////////////////////////////////////////////////////////////////////////////////
-	VulkanSwapChain::VulkanSwapChain(Window* window, VkSurfaceKHR surface, ImageFormat requestedFormat) // Note: The swapchain takes ownership of the surface
-		: m_Surface(surface), m_Window(window)
+	VulkanSwapChain::VulkanSwapChain(Window* window, VkSurfaceKHR surface, ImageFormat requestedFormat, LatencyMode latency, uint8_t framesInFlight) // Note: The swapchain takes ownership of the surface
+		: m_Surface(surface), m_Window(window), m_FramesInFlight(framesInFlight), m_LatencyMode(latency)
 	{
+		LU_ASSERT(((framesInFlight > 0) && (framesInFlight <= RendererSpecification::MaxFramesInFlight)), std::format("[VkSwapChain] Frames in flight must be between 1 and {0}.", RendererSpecification::MaxFramesInFlight));
+
+		VulkanDevice& device = VulkanContext::GetVulkanDevice();
+
 		FindImageFormatAndColorSpace(requestedFormat);
 
 		// Synchronization objects
 		VkSemaphoreCreateInfo semaphoreInfo = {};
 		semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
-		for (size_t i = 0; i < RendererSpecification::FramesInFlight; i++)
+		VkFenceCreateInfo fenceInfo = {};
+		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT; // Note: So the first wait on every frame returns immediately
+
+		for (size_t i = 0; i < RendererSpecification::MaxFramesInFlight; i++)
+		{
+			VK_VERIFY(vkCreateSemaphore(device.GetVkDevice(), &semaphoreInfo, nullptr, &m_ImageAvailableSemaphores[i]));
+			VK_VERIFY(vkCreateFence(device.GetVkDevice(), &fenceInfo, nullptr, &m_InFlightFences[i]));
+		}
+
+		for (size_t i = 0; i < MaxImages; i++)
+			VK_VERIFY(vkCreateSemaphore(device.GetVkDevice(), &semaphoreInfo, nullptr, &m_RenderFinishedSemaphores[i]));
+
+		// Frame command buffers
+		VkCommandPoolCreateInfo poolInfo = {};
+		poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+		poolInfo.queueFamilyIndex = device.GetQueueFamily();
+
+		VK_VERIFY(vkCreateCommandPool(device.GetVkDevice(), &poolInfo, nullptr, &m_CommandPool));
+
+		VkCommandBufferAllocateInfo allocInfo = {};
+		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		allocInfo.commandPool = m_CommandPool;
+		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		allocInfo.commandBufferCount = static_cast<uint32_t>(m_CommandBuffers.size());
+
+		VK_VERIFY(vkAllocateCommandBuffers(device.GetVkDevice(), &allocInfo, m_CommandBuffers.data()));
+		VK_VERIFY(vkAllocateCommandBuffers(device.GetVkDevice(), &allocInfo, m_StartCommandBuffers.data()));
+
+		// Frame statistics
+		VkPhysicalDeviceProperties properties = {};
+		vkGetPhysicalDeviceProperties(VulkanContext::GetVulkanPhysicalDevice().GetVkPhysicalDevice(), &properties);
+
+		uint32_t queueFamilyCount = 0;
+		vkGetPhysicalDeviceQueueFamilyProperties(VulkanContext::GetVulkanPhysicalDevice().GetVkPhysicalDevice(), &queueFamilyCount, nullptr);
+
+		SmallVector<VkQueueFamilyProperties, 8> queueFamilies(queueFamilyCount);
+		vkGetPhysicalDeviceQueueFamilyProperties(VulkanContext::GetVulkanPhysicalDevice().GetVkPhysicalDevice(), &queueFamilyCount, queueFamilies.Data());
+
+		uint32_t validBits = queueFamilies[device.GetQueueFamily()].timestampValidBits;
+		if (properties.limits.timestampComputeAndGraphics && (validBits != 0))
 		{
-			VK_VERIFY(vkCreateSemaphore(VulkanContext::GetVulkanDevice().GetVkDevice(), &semaphoreInfo, nullptr, &m_ImageAvailableSemaphores[i]));
-			VK_VERIFY(vkCreateSemaphore(VulkanContext::GetVulkanDevice().GetVkDevice(), &semaphoreInfo, nullptr, &m_RenderFinishedSemaphores[i]));
+			m_TimestampPeriod = static_cast<double>(properties.limits.timestampPeriod);
+			m_TimestampMask = ((validBits >= 64) ? std::numeric_limits<uint64_t>::max() : ((1ull << validBits) - 1));
+
+			VkQueryPoolCreateInfo queryPoolInfo = {};
+			queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+			queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+			queryPoolInfo.queryCount = static_cast<uint32_t>(2 * RendererSpecification::MaxFramesInFlight);
+
+			VK_VERIFY(vkCreateQueryPool(device.GetVkDevice(), &queryPoolInfo, nullptr, &m_TimestampPool));
 		}
+
+		// Latency
+		if (device.SupportsPresentWait())
+			m_WaitForPresent = reinterpret_cast<PFN_vkWaitForPresentKHR>(vkGetDeviceProcAddr(device.GetVkDevice(), "vkWaitForPresentKHR"));
+
+		m_Statistics.PresentWait = (m_WaitForPresent != nullptr);
+		SetLatencyMode(latency);
 	}
 
 	VulkanSwapChain::~VulkanSwapChain()
@@ -44,11 +117,23 @@ namespace Lumen::Internal
 		if (m_SwapChain)
 			vkDestroySwapchainKHR(device.GetVkDevice(), m_SwapChain, nullptr);
 
-		for (auto& image : m_Images)
-			image.Destroy();
+		for (uint32_t i = 0; i < m_ImageCount; i++)
+			m_Images[i].Destroy();
 
-		for (size_t i = 0; i < RendererSpecification::FramesInFlight; i++)
+		for (size_t i = 0; i < RendererSpecification::MaxFramesInFlight; i++)
+		{
 			vkDestroySemaphore(device.GetVkDevice(), m_ImageAvailableSemaphores[i], nullptr);
+			vkDestroyFence(device.GetVkDevice(), m_InFlightFences[i], nullptr);
+		}
+
+		for (size_t i = 0; i < MaxImages; i++)
+			vkDestroySemaphore(device.GetVkDevice(), m_RenderFinishedSemaphores[i], nullptr);
+
+		// Note: Also frees all command buffers allocated from it
+		vkDestroyCommandPool(device.GetVkDevice(), m_CommandPool, nullptr);
+
+		if (m_TimestampPool)
+			vkDestroyQueryPool(device.GetVkDevice(), m_TimestampPool, nullptr);
 
 		vkDestroySurfaceKHR(VulkanContext::GetVkInstance(), m_Surface, nullptr);
 	}
@@ -56,11 +141,226 @@ namespace Lumen::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	// Methods
 	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanSwapChain::WaitForFrame()
+	{
+		LU_PROFILE("VkSwapChain::WaitForFrame()");
+
+		m_CurrentFrame = static_cast<uint32_t>(m_FrameCount % m_FramesInFlight);
+
+		Throttle();
+	}
+
+	void VulkanSwapChain::BeginFrame()
+	{
+		LU_PROFILE("VkSwapChain::BeginFrame()");
+
+		// Note: Applied here so a drag-resize recreates at most once per frame
+		if (m_ResizePending)
+			Recreate(m_PendingWidth, m_PendingHeight);
+
+		AcquireNextImage();
+		WriteStartTimestamp();
+	}
+
+	void VulkanSwapChain::EndFrame()
+	{
+		LU_PROFILE("VkSwapChain::EndFrame()");
+
+		VulkanDevice& device = VulkanContext::GetVulkanDevice();
+		VkCommandBuffer cmd = m_CommandBuffers[m_CurrentFrame];
+
+		VK_VERIFY(vkResetFences(device.GetVkDevice(), 1, &m_InFlightFences[m_CurrentFrame]));
+		VK_VERIFY(vkResetCommandBuffer(cmd, 0));
+
+		VkCommandBufferBeginInfo beginInfo = {};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+		VK_VERIFY(vkBeginCommandBuffer(cmd, &beginInfo));
+
+		// Note: Every frame ends with this command buffer, so the GPU timestamps are read back here
+		VulkanRenderer::GetRenderer().GetProfiler().Collect(cmd);
+
+		{
+			LU_PROFILE_GPU(cmd, "VkSwapChain::EndFrame()");
+
+			// Note: Nothing renders to the swapchain images yet, so their contents are discarded
+			VkImageMemoryBarrier barrier = {};
+			barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.image = m_Images[m_AcquiredImage]->GetVkImage();
+			barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			barrier.subresourceRange.baseMipLevel = 0;
+			barrier.subresourceRange.levelCount = 1;
+			barrier.subresourceRange.baseArrayLayer = 0;
+			barrier.subresourceRange.layerCount = 1;
+			barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			barrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+			barrier.srcAccessMask = 0;
+			barrier.dstAccessMask = 0;
+
+			vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+			FrameStatistics::AddBarriers();
+		}
+
+		// Note: Last command of the frame's final command buffer, the start was written by WriteStartTimestamp
+		if (m_TimestampPool)
+		{
+			vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_TimestampPool, m_CurrentFrame * 2 + 1);
+			m_TimestampFrames[m_CurrentFrame] = FrameStatistics::GetCurrentFrame();
+		}
+
+		VK_VERIFY(vkEndCommandBuffer(cmd));
+
+		VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+		VkSubmitInfo submitInfo = {};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.waitSemaphoreCount = 1;
+		submitInfo.pWaitSemaphores = &m_ImageAvailableSemaphores[m_CurrentFrame];
+		submitInfo.pWaitDstStageMask = &waitStage;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &cmd;
+		submitInfo.signalSemaphoreCount = 1;
+		submitInfo.pSignalSemaphores = &m_RenderFinishedSemaphores[m_AcquiredImage];
+
+		VK_VERIFY(vkQueueSubmit(device.GetGraphicsQueue(), 1, &submitInfo, m_InFlightFences[m_CurrentFrame]));
+		FrameStatistics::AddSubmits();
+	}
+
+	void VulkanSwapChain::Present()
+	{
+		LU_PROFILE("VkSwapChain::Present()");
+
+		uint64_t presentID = m_FrameCount + 1;
+
+		VkPresentIdKHR presentIDInfo = {};
+		presentIDInfo.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+		presentIDInfo.swapchainCount = 1;
+		presentIDInfo.pPresentIds = &presentID;
+
+		VkPresentInfoKHR presentInfo = {};
+		presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+		presentInfo.pNext = (m_WaitForPresent ? &presentIDInfo : nullptr);
+		presentInfo.waitSemaphoreCount = 1;
+		presentInfo.pWaitSemaphores = &m_RenderFinishedSemaphores[m_AcquiredImage];
+		presentInfo.swapchainCount = 1;
+		presentInfo.pSwapchains = &m_SwapChain;
+		presentInfo.pImageIndices = &m_AcquiredImage;
+
+		VkResult result = vkQueuePresentKHR(VulkanContext::GetVulkanDevice().GetPresentQueue(), &presentInfo);
+		m_FrameCount++;
+
+		if (result == VK_ERROR_OUT_OF_DATE_KHR) // Note: Suboptimal swapchains get recreated by the resize event
+			Resize(m_Window->GetSize().x, m_Window->GetSize().y, m_VSync);
+		else if ((result != VK_SUCCESS) && (result != VK_SUBOPTIMAL_KHR))
+			LU_LOG_ERROR("[VkSwapChain] Failed to present SwapChain image!");
+	}
+
 	void VulkanSwapChain::Resize(uint32_t width, uint32_t height, bool vsync)
 	{
 		if (width == 0 || height == 0)
 			return;
 
+		m_VSync = vsync;
+
+		// Note: The first swapchain is created immediately, so the images exist before the first frame
+		if (!m_SwapChain)
+		{
+			Recreate(width, height);
+			return;
+		}
+
+		m_ResizePending = true;
+		m_PendingWidth = width;
+		m_PendingHeight = height;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Setters
+	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanSwapChain::SetFramesInFlight(uint8_t frames)
+	{
+		LU_ASSERT(((frames > 0) && (frames <= RendererSpecification::MaxFramesInFlight)), std::format("[VkSwapChain] Frames in flight must be between 1 and {0}.", RendererSpecification::MaxFramesInFlight));
+
+		if (frames == m_FramesInFlight)
+			return;
+
+		// Note: The frame to slot mapping changes, so nothing may still reference the old slots
+		VulkanContext::GetVulkanDevice().Wait();
+
+		m_FramesInFlight = std::clamp<uint32_t>(frames, 1, RendererSpecification::MaxFramesInFlight);
+		m_FirstFrame = m_FrameCount;
+
+		SetLatencyMode(m_LatencyMode);
+	}
+
+	void VulkanSwapChain::SetLatencyMode(LatencyMode mode)
+	{
+		m_LatencyMode = mode;
+
+		switch (mode)
+		{
+		case LatencyMode::Throughput:
+			SetQueuedFrames(m_FramesInFlight);
+			break;
+		case LatencyMode::Balanced:
+			SetQueuedFrames(std::min<uint32_t>(2, m_FramesInFlight));
+			break;
+		case LatencyMode::Low:
+			SetQueuedFrames(1);
+			break;
+
+		default:
+			LU_ASSERT(false, "[VkSwapChain] Invalid latency mode passed in.");
+			break;
+		}
+	}
+
+	void VulkanSwapChain::SetQueuedFrames(uint32_t frames)
+	{
+		LU_ASSERT(((frames > 0) && (frames <= m_FramesInFlight)), std::format("[VkSwapChain] Queued frames must be between 1 and {0}.", m_FramesInFlight));
+
+		m_QueuedFrames = std::clamp<uint32_t>(frames, 1, m_FramesInFlight);
+		m_Statistics.QueuedFrames = m_QueuedFrames;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	uint32_t VulkanSwapChain::AcquireNextImage()
+	{
+		LU_PROFILE("VkSwapChain::AcquireImage()");
+		uint32_t imageIndex = 0;
+
+		VkResult result = vkAcquireNextImageKHR(VulkanContext::GetVulkanDevice().GetVkDevice(), m_SwapChain, std::numeric_limits<uint64_t>::max(), m_ImageAvailableSemaphores[m_CurrentFrame], VK_NULL_HANDLE, &imageIndex);
+		if (result == VK_ERROR_OUT_OF_DATE_KHR)
+		{
+			// Note: The semaphore wasn't signaled, so we can reuse it for the new swapchain
+			Recreate(m_Window->GetSize().x, m_Window->GetSize().y);
+			result = vkAcquireNextImageKHR(VulkanContext::GetVulkanDevice().GetVkDevice(), m_SwapChain, std::numeric_limits<uint64_t>::max(), m_ImageAvailableSemaphores[m_CurrentFrame], VK_NULL_HANDLE, &imageIndex);
+		}
+
+		if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
+		{
+			LU_LOG_ERROR("[VulkanSwapChain] Failed to acquire SwapChain image!");
+		}
+
+		m_AcquiredImage = imageIndex;
+		return imageIndex;
+	}
+
+	void VulkanSwapChain::Recreate(uint32_t width, uint32_t height)
+	{
+		LU_PROFILE("VkSwapChain::Recreate()");
+
+		m_ResizePending = false;
+		if (width == 0 || height == 0)
+			return;
+
+		bool vsync = m_VSync;
+
 		///////////////////////////////////////////////////////////
 		// SwapChain
 		///////////////////////////////////////////////////////////
@@ -89,7 +389,7 @@ namespace Lumen::Internal
 		// It's the lowest latency non-tearing present mode available
 		if (!vsync)
 		{
-			for (size_t i = 0; i < details.PresentModes.size(); i++)
+			for (size_t i = 0; i < details.PresentModes.Size(); i++)
 			{
 				if (details.PresentModes[i] == VK_PRESENT_MODE_MAILBOX_KHR)
 				{
@@ -103,8 +403,11 @@ namespace Lumen::Internal
 			}
 		}
 
-		LU_ASSERT((details.Capabilities.minImageCount <= RendererSpecification::FramesInFlight), "[VkSwapChain] FramesInFlight is less than the minimum amount of SwapChain images.");
-		LU_ASSERT((RendererSpecification::FramesInFlight < details.Capabilities.maxImageCount), "[VkSwapChain] FramesInFlight is more than the maximum amount of SwapChain images.");
+		// Note: One more than the minimum, so acquiring doesn't have to wait on the presentation engine
+		uint32_t requestedImages = details.Capabilities.minImageCount + 1;
+		if (details.Capabilities.maxImageCount > 0) // Note: 0 means there is no maximum
+			requestedImages = std::min(requestedImages, details.Capabilities.maxImageCount);
+		requestedImages = std::min(requestedImages, MaxImages);
 
 		// Find the transformation of the surface
 		VkSurfaceTransformFlagsKHR preTransform;
@@ -116,7 +419,7 @@ namespace Lumen::Internal
 		// Find a supported composite alpha format (not all devices support alpha opaque)
 		VkCompositeAlphaFlagBitsKHR compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
 		// Simply select the first composite alpha format available
-		std::vector<VkCompositeAlphaFlagBitsKHR> compositeAlphaFlags = {
+		Array<VkCompositeAlphaFlagBitsKHR, 4> compositeAlphaFlags = {
 			VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
 			VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR,
 			VK_COMPOSITE_ALPHA_POST_MULTIPLIED_BIT_KHR,
@@ -135,7 +438,7 @@ namespace Lumen::Internal
 		swapchainCI.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
 		swapchainCI.pNext = nullptr;
 		swapchainCI.surface = m_Surface;
-		swapchainCI.minImageCount = static_cast<uint32_t>(RendererSpecification::FramesInFlight);
+		swapchainCI.minImageCount = requestedImages;
 		swapchainCI.imageFormat = m_ColourFormat;
 		swapchainCI.imageColorSpace = m_ColourSpace;
 		swapchainCI.imageExtent = { swapchainExtent.width, swapchainExtent.height };
@@ -162,15 +465,20 @@ namespace Lumen::Internal
 		auto oldSwapchain = m_SwapChain;
 		VK_VERIFY(vkCreateSwapchainKHR(device, &swapchainCI, nullptr, &m_SwapChain));
 
+		// Note: The old swapchain may still have presents in flight from the other frames. This frame's garbage
+		// has already been disposed, so it's retired the next time this frame's fence has been waited on,
+		// which is FramesInFlight frames later. No image of it is acquired at this point.
 		if (oldSwapchain)
-			vkDestroySwapchainKHR(device, oldSwapchain, nullptr); // Destroys swapchain images
+			VulkanRenderer::GetRenderer().GetGarbageCollector().Collect(SwapChainGarbageEntry(oldSwapchain)); // Destroys swapchain images
+
+		m_FirstPresentID = m_FrameCount + 1;
 
 		// Get the swap chain images
 		uint32_t imageCount = 0;
-		Array<VkImage, RendererSpecification::FramesInFlight> tempImages = { };
+		Array<VkImage, MaxImages> tempImages = { };
 
 		VK_VERIFY(vkGetSwapchainImagesKHR(device, m_SwapChain, &imageCount, nullptr));
-		LU_ASSERT((imageCount == RendererSpecification::FramesInFlight), "[VkSwapChain] Created image count doesn't match requested FramesInFlight");
+		LU_ASSERT((imageCount <= MaxImages), std::format("[VkSwapChain] Created image count ({0}) is more than the maximum of {1}.", imageCount, MaxImages));
 		VK_VERIFY(vkGetSwapchainImagesKHR(device, m_SwapChain, &imageCount, tempImages.data()));
 
 		for (uint32_t i = 0; i < imageCount; i++)
@@ -201,57 +509,115 @@ namespace Lumen::Internal
 				.Usage = ImageUsage::Colour,
 				.Layout = ImageLayout::Undefined,
 				.Format = VkFormatToImageFormat(m_ColourFormat),
-				.Width = width,
-				.Height = height,
+				.Width = swapchainExtent.width,
+				.Height = swapchainExtent.height,
 				.MipMaps = false
 			};
 
-			/* // TODO: ... (commandBuffer)
-			if (m_Images[i].GetWidth() != 0 && m_Images[i].GetHeight() != 0)
-			{
-				VulkanImage& src = m_Images[i];
-
-				// Destroy old image view
-				m_Window->GetRenderer().GetInternalRenderer().Free([device = device, imageView = src.m_ImageView]()
-					{
-						vkDestroyImageView(device, imageView, nullptr);
-					});
-
-				// Set new data
-				src.m_ImageSpecification = specs;
-				src.m_Image = tempImages[i];
-				src.m_ImageView = imageView;
-			}
-			else
-				m_Images[i].Init(m_Window->GetRenderer().GetID(), specs, tempImages[i], imageView);
+			// Note: The old image's view gets collected by the garbage collector
+			if (i < m_ImageCount)
+				m_Images[i].Destroy();
 
-			// We transition manually since, the layout set in the specification doesn't get used
-			// since we manually set all the data.
-			m_Images[i].Transition(m_RendererID, ImageLayout::Undefined, ImageLayout::PresentSrcKHR);
-			*/
+			m_Images[i].Construct(specs, tempImages[i], imageView);
 		}
+
+		for (uint32_t i = imageCount; i < m_ImageCount; i++)
+			m_Images[i].Destroy();
+
+		m_ImageCount = imageCount;
 	}
 
-	////////////////////////////////////////////////////////////////////////////////////
-	// Private methods
-	////////////////////////////////////////////////////////////////////////////////////
-	uint32_t VulkanSwapChain::AcquireNextImage()
+	void VulkanSwapChain::Throttle()
 	{
-		LU_PROFILE("VkSwapChain::AcquireImage()");
-		uint32_t imageIndex = 0;
+		LU_PROFILE("VkSwapChain::Throttle()");
 
-		VkResult result = vkAcquireNextImageKHR(VulkanContext::GetVulkanDevice().GetVkDevice(), m_SwapChain, std::numeric_limits<uint64_t>::max(), m_ImageAvailableSemaphores[m_CurrentFrame], VK_NULL_HANDLE, &imageIndex);
-		if (result == VK_ERROR_OUT_OF_DATE_KHR)
+		VkDevice device = VulkanContext::GetVulkanDevice().GetVkDevice();
+		double start = GetTime();
+
+		// Wait for the frame m_QueuedFrames behind us, this bounds how far the CPU runs ahead
+		if (m_FrameCount >= m_FirstFrame + m_QueuedFrames)
 		{
-			Resize(m_Window->GetSize().x, m_Window->GetSize().y, m_Window->GetRenderer().GetSpecification().VSync);
+			uint64_t frame = m_FrameCount - m_QueuedFrames;
+			uint32_t index = static_cast<uint32_t>(frame % m_FramesInFlight);
+
+			bool presented = false;
+			if ((m_LatencyMode == LatencyMode::Low) && m_WaitForPresent && (frame + 1 >= m_FirstPresentID))
+			{
+				// Note: Paces the start of the frame on the display instead of the GPU
+				presented = (m_WaitForPresent(device, m_SwapChain, frame + 1, PresentWaitTimeout) == VK_SUCCESS);
+				if (presented)
+					Sample(frame, GetTime());
+			}
+
+			VK_VERIFY(vkWaitForFences(device, 1, &m_InFlightFences[index], VK_TRUE, std::numeric_limits<uint64_t>::max()));
+			if (!presented)
+				Sample(frame, GetTime()); // Note: Overestimates if the fence was signaled before we started waiting
 		}
-		else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
+
+		// Note: When queueing less than FramesInFlight frames this never blocks
+		VK_VERIFY(vkWaitForFences(device, 1, &m_InFlightFences[m_CurrentFrame], VK_TRUE, std::numeric_limits<uint64_t>::max()));
+		ReadTimestamps();
+
+		m_FrameStarts[m_CurrentFrame] = start;
+		m_Statistics.CPUWait = GetTime() - start;
+	}
+
+	void VulkanSwapChain::Sample(uint64_t frame, double now)
+	{
+		double latency = now - m_FrameStarts[frame % m_FramesInFlight];
+
+		m_Statistics.LastLatency = latency;
+		m_Statistics.Latency = ((m_Statistics.Latency == 0.0) ? latency : (m_Statistics.Latency + LatencySmoothing * (latency - m_Statistics.Latency)));
+
+		LU_PROFILE_PLOT("Latency (ms)", latency);
+	}
+
+	void VulkanSwapChain::WriteStartTimestamp()
+	{
+		if (!m_TimestampPool)
+			return;
+
+		VkCommandBuffer cmd = m_StartCommandBuffers[m_CurrentFrame];
+
+		// Note: The slot's fence has been waited on in WaitForFrame, the fence of EndFrame's submit covers this one as well
+		VK_VERIFY(vkResetCommandBuffer(cmd, 0));
+
+		VkCommandBufferBeginInfo beginInfo = {};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+		VK_VERIFY(vkBeginCommandBuffer(cmd, &beginInfo));
+		vkCmdResetQueryPool(cmd, m_TimestampPool, m_CurrentFrame * 2, 2);
+		vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_TimestampPool, m_CurrentFrame * 2);
+		VK_VERIFY(vkEndCommandBuffer(cmd));
+
+		// Note: Submitted before the defragmenter's copies, readbacks & the frame's own work, so the GPU time spans all of them
+		VkSubmitInfo submitInfo = {};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &cmd;
+
+		VK_VERIFY(vkQueueSubmit(VulkanContext::GetVulkanDevice().GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE));
+		FrameStatistics::AddSubmits();
+	}
+
+	void VulkanSwapChain::ReadTimestamps()
+	{
+		uint64_t frame = m_TimestampFrames[m_CurrentFrame];
+		if (!m_TimestampPool || (frame == 0))
+			return;
+
+		// Note: The slot's fence has been waited on, so the results are available
+		Array<uint64_t, 2> timestamps = { };
+		VkResult result = vkGetQueryPoolResults(VulkanContext::GetVulkanDevice().GetVkDevice(), m_TimestampPool, m_CurrentFrame * 2, 2, sizeof(timestamps), timestamps.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+		if (result == VK_SUCCESS)
 		{
-			LU_LOG_ERROR("[VulkanSwapChain] Failed to acquire SwapChain image!");
+			// Note: Only the low timestampValidBits are defined, the difference is taken modulo that width in case the counter wrapped
+			uint64_t ticks = ((timestamps[1] & m_TimestampMask) - (timestamps[0] & m_TimestampMask)) & m_TimestampMask;
+			FrameStatistics::SetGPUTime(frame, static_cast<double>(ticks) * m_TimestampPeriod / 1'000'000.0);
 		}
 
-		m_AcquiredImage = imageIndex;
-		return imageIndex;
+		m_TimestampFrames[m_CurrentFrame] = 0;
 	}
 
 	void VulkanSwapChain::FindImageFormatAndColorSpace(ImageFormat requestedFormat)
@@ -262,8 +628,8 @@ namespace Lumen::Internal
 		uint32_t formatCount;
 		vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, m_Surface, &formatCount, nullptr);
 
-		std::vector<VkSurfaceFormatKHR> surfaceFormats(formatCount);
-		vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, m_Surface, &formatCount, surfaceFormats.data());
+		SmallVector<VkSurfaceFormatKHR, 8> surfaceFormats(formatCount);
+		vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, m_Surface, &formatCount, surfaceFormats.Data());
 
 		// If the surface format list only includes one entry with VK_FORMAT_UNDEFINED,
 		// there is no preferered format, so we assume VK_FORMAT_B8G8R8A8_UNORM
@@ -17,44 +17,90 @@ namespace Lumen::Internal
 
     class Window;
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanLatencyStatistics
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct VulkanLatencyStatistics
+    {
+    public:
+        double Latency = 0.0;       // Smoothed estimate in milliseconds from the start of a frame (input sampling) to its presentation
+        double LastLatency = 0.0;   // Latest sample in milliseconds
+        double CPUWait = 0.0;       // Milliseconds the CPU was throttled at the start of the last frame
+
+        uint32_t QueuedFrames = 0;
+        bool PresentWait = false;   // Note: If false, presentation is estimated by the frame's fence
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // VulkanSwapChain
     ////////////////////////////////////////////////////////////////////////////////////
     class VulkanSwapChain
     {
+    public:
+        // Settings
+        inline constexpr static const double LatencySmoothing = 0.1; // Note: Weight of a new sample in the smoothed latency
+        inline constexpr static const uint64_t PresentWaitTimeout = 100'000'000; // Note: In nanoseconds
+        inline constexpr static const uint32_t MaxImages = 8; // Note: The image count is independent of the frames in flight
     public:
         // Constructors & Destructor
-        VulkanSwapChain(Window* window, VkSurfaceKHR surface, ImageFormat requestedFormat);
+        VulkanSwapChain(Window* window, VkSurfaceKHR surface, ImageFormat requestedFormat, LatencyMode latency = LatencyMode::Balanced, uint8_t framesInFlight = RendererSpecification::DefaultFramesInFlight);
         ~VulkanSwapChain();
 
         // Methods
-        void Resize(uint32_t width, uint32_t height, bool vsync);
+        void WaitForFrame(); // Note: Throttles the CPU according to the latency mode, afterwards the current frame's resources are no longer in use
+        void BeginFrame();   // Note: Applies a pending resize and acquires the next image, call after WaitForFrame & disposing the frame's garbage
+        void EndFrame();
+        void Present();
+
+        void Resize(uint32_t width, uint32_t height, bool vsync); // Note: Deferred to the next BeginFrame, once a swapchain exists
+
+        // Setters
+        void SetFramesInFlight(uint8_t frames); // Note: Waits for the device to be idle, so don't call this every frame
+        void SetLatencyMode(LatencyMode mode);
+        void SetQueuedFrames(uint32_t frames); // Note: 1 - FramesInFlight, overrides the latency mode's amount
 
         // Getters
         forceinline VkFormat GetColourFormat() const { return m_ColourFormat; }
 
+        forceinline LatencyMode GetLatencyMode() const { return m_LatencyMode; }
+        forceinline const VulkanLatencyStatistics& GetLatencyStatistics() const { return m_Statistics; }
+
         forceinline uint32_t GetCurrentFrame() const { return m_CurrentFrame; }
         forceinline uint32_t GetAquiredImage() const { return m_AcquiredImage; }
+        forceinline uint32_t GetFramesInFlight() const { return m_FramesInFlight; }
+        forceinline uint32_t GetImageCount() const { return m_ImageCount; }
 
-        forceinline Array<DeferredConstruct<VulkanImage, true>, RendererSpecification::FramesInFlight>& GetSwapChainImages() { return m_Images; }
+        forceinline Array<DeferredConstruct<VulkanImage, true>, MaxImages>& GetSwapChainImages() { return m_Images; } // Note: Only the first GetImageCount() are constructed
 
         forceinline VkSurfaceKHR GetVkSurface() const { return m_Surface; }
 
         forceinline VkSemaphore GetImageAvailableSemaphore() const { return m_ImageAvailableSemaphores[m_CurrentFrame]; }
-        forceinline VkSemaphore GetRenderFinishedSemaphore() const { return m_RenderFinishedSemaphores[m_CurrentFrame]; }
+        forceinline VkSemaphore GetRenderFinishedSemaphore() const { return m_RenderFinishedSemaphores[m_AcquiredImage]; }
 
     private:
         // Private methods
         uint32_t AcquireNextImage();
+        void Recreate(uint32_t width, uint32_t height);
         void FindImageFormatAndColorSpace(ImageFormat requestedFormat);
 
+        void Throttle();
+        void Sample(uint64_t frame, double now);
+        void WriteStartTimestamp();
+        void ReadTimestamps();
+
     private:
         VkSwapchainKHR m_SwapChain = VK_NULL_HANDLE;
         VkSurfaceKHR m_Surface;
 
-        Array<DeferredConstruct<VulkanImage, true>, RendererSpecification::FramesInFlight> m_Images = { };
-        Array<VkSemaphore, RendererSpecification::FramesInFlight> m_ImageAvailableSemaphores = { };
-        Array<VkSemaphore, RendererSpecification::FramesInFlight> m_RenderFinishedSemaphores = { };
+        // Note: Per frame resources are allocated for the maximum, so the frames in flight can change at runtime
+        Array<DeferredConstruct<VulkanImage, true>, MaxImages> m_Images = { };
+        Array<VkSemaphore, MaxImages> m_RenderFinishedSemaphores = { }; // Note: Per image, since presentation of an image is only known to be done once it's reacquired
+        Array<VkSemaphore, RendererSpecification::MaxFramesInFlight> m_ImageAvailableSemaphores = { };
+        Array<VkFence, RendererSpecification::MaxFramesInFlight> m_InFlightFences = { };
+
+        VkCommandPool m_CommandPool = VK_NULL_HANDLE;
+        Array<VkCommandBuffer, RendererSpecification::MaxFramesInFlight> m_CommandBuffers = { };
+        Array<VkCommandBuffer, RendererSpecification::MaxFramesInFlight> m_StartCommandBuffers = { }; // Note: Only write the frame's first timestamp, submitted before any other work of the frame
 
         VkFormat m_ColourFormat = VK_FORMAT_UNDEFINED;
         VkColorSpaceKHR m_ColourSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
@@ -63,6 +109,31 @@ namespace Lumen::Internal
 
         uint32_t m_CurrentFrame = 0;
         uint32_t m_AcquiredImage = 0;
+        uint32_t m_ImageCount = 0;
+        uint32_t m_FramesInFlight;
+        bool m_VSync = true;
+
+        bool m_ResizePending = false;
+        uint32_t m_PendingWidth = 0, m_PendingHeight = 0;
+
+        uint64_t m_FrameCount = 0; // Note: Also used as present id, offset by 1 since 0 means no id
+        uint64_t m_FirstPresentID = 1; // Note: First present id of the current swapchain
+        uint64_t m_FirstFrame = 0; // Note: First frame since the frames in flight last changed
+
+        // Latency
+        LatencyMode m_LatencyMode;
+        uint32_t m_QueuedFrames = RendererSpecification::DefaultFramesInFlight;
+
+        PFN_vkWaitForPresentKHR m_WaitForPresent = nullptr;
+
+        Array<double, RendererSpecification::MaxFramesInFlight> m_FrameStarts = { }; // Note: In milliseconds
+        VulkanLatencyStatistics m_Statistics = {};
+
+        // Frame statistics
+        VkQueryPool m_TimestampPool = VK_NULL_HANDLE; // Note: Two timestamps per frame in flight, null if the graphics queue doesn't support timestamps
+        double m_TimestampPeriod = 0.0; // Note: Nanoseconds per tick
+        uint64_t m_TimestampMask = 0; // Note: The graphics queue's timestampValidBits, the bits above it are undefined
+        Array<uint64_t, RendererSpecification::MaxFramesInFlight> m_TimestampFrames = { }; // Note: FrameStatistics frame that wrote the slot's timestamps, 0 if none
     };
 
 }
\ No newline at end of file
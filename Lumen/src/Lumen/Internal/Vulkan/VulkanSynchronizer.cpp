@@ -5,23 +5,69 @@
 #include "Lumen/Internal/Utils/Profiler.hpp"
 
 #include "Lumen/Internal/Vulkan/VulkanContext.hpp"
+#include "Lumen/Internal/Vulkan/VulkanRenderer.hpp"
 #include "Lumen/Internal/Vulkan/VulkanCommandBuffer.hpp"
 
 namespace Lumen::Internal
 {
 
+	////////////////////////////////////////////////////////////////////////////////////
+	// Methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void VulkanSynchronizer::ResetFrame(uint8_t frameIndex)
+	{
+		LU_PROFILE("VkSynchronizer::ResetFrame()");
+
+		VulkanFrame& frame = m_Frames[frameIndex];
+
+		// Note: The vector's storage lives in the arena, so it's released before the arena reuses it
+		std::pmr::vector<GraphElement>(&frame.Arena).swap(frame.Elements);
+		frame.Arena.Reset();
+	}
+
+	void VulkanSynchronizer::ResetAll()
+	{
+		for (uint8_t i = 0; i < static_cast<uint8_t>(m_Frames.size()); i++)
+			ResetFrame(i);
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Frame
 	////////////////////////////////////////////////////////////////////////////////////
 	void VulkanSynchronizer::BakeFrameGraph(const FrameGraph& frame, uint8_t frameIndex)
 	{
+		LU_PROFILE("VkSynchronizer::BakeFrameGraph()");
+
+		#if defined(LU_CONFIG_DEBUG)
+		// Note: A null command is allowed (f.e. an element that only waits), a stale one is not
+		const VulkanCommandBufferPool& pool = VulkanCommandBuffer::GetPool();
+		for (const GraphElement& element : frame.Elements)
+		{
+			LU_ASSERT((!element.Command || pool.IsValid(element.Command)), "[VkSynchronizer] Frame graph references a destroyed command buffer.");
 
+			for (const Waitable& waitable : element.WaitOn)
+			{
+				if (waitable.Operation == WaitOperation::CommandBuffer)
+					LU_ASSERT(pool.IsValid(waitable.Command), "[VkSynchronizer] Frame graph waits on a null or destroyed command buffer.");
+			}
+		}
+		#endif
+
+		// Note: Copies into the frame's arena, every WaitOn list is allocated there too
+		m_Frames[frameIndex].Elements.assign(frame.Elements.begin(), frame.Elements.end());
 	}
 
 	void VulkanSynchronizer::BakeCurrentFrameGraph(const FrameGraph& frame)
 	{
-		//BakeFrameGraph(frame, );
-		//BakeFrameGraph(frame, ); // TODO: Use SwapChain frame
+		BakeFrameGraph(frame, static_cast<uint8_t>(VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame()));
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Getters
+	////////////////////////////////////////////////////////////////////////////////////
+	LinearArena& VulkanSynchronizer::GetFrameArena()
+	{
+		return GetFrameArena(static_cast<uint8_t>(VulkanRenderer::GetRenderer().GetVulkanSwapChain().GetCurrentFrame()));
 	}
 
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Lumen/Internal/Memory/Array.hpp"
+#include "Lumen/Internal/Memory/LinearArena.hpp"
 
 #include "Lumen/Internal/Vulkan/Vulkan.hpp"
 
@@ -12,7 +13,7 @@
 #include <cstdint>
 #include <tuple>
 #include <utility>
-#include <unordered_map>
+#include <memory_resource>
 
 namespace Lumen::Internal
 {
@@ -25,6 +26,9 @@ namespace Lumen::Internal
     public:
         //Array<std::pair<VkSemaphore, uint64_t>, static_cast<size_t>(Queue::COUNT)> TimelineSemaphores;
         //std::unordered_map<CommandBuffer*, std::pair<Queue, uint64_t>> a;
+
+        LinearArena Arena = {}; // Note: Transient CPU data of this frame, reset once the frame's fence has been waited on
+        std::pmr::vector<GraphElement> Elements = std::pmr::vector<GraphElement>(&Arena); // Note: The baked frame graph
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -38,13 +42,19 @@ namespace Lumen::Internal
         ~VulkanSynchronizer() = default;
 
         // Methods
+        void ResetFrame(uint8_t frameIndex); // Note: Only call when the GPU is done with the frame
+        void ResetAll();
 
         // Frame
         void BakeFrameGraph(const FrameGraph& frame, uint8_t frameIndex);
         void BakeCurrentFrameGraph(const FrameGraph& frame);
 
+        // Getters
+        LinearArena& GetFrameArena();
+        forceinline LinearArena& GetFrameArena(uint8_t frameIndex) { return m_Frames[frameIndex].Arena; }
+
     private:
-        //Array<
+        Array<VulkanFrame, RendererSpecification::MaxFramesInFlight> m_Frames = { };
     };
 
 }
@@ -0,0 +1,356 @@
+#include "lupch.h"
+#include "Random.hpp"
+
+#include <bit>
+#include <cstring>
+
+// Note: The AVX2 paths are compiled for their functions only and picked at runtime,
+//       so the default build runs on any x86-64 CPU. Other architectures use the scalar path.
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <immintrin.h>
+    #define LU_RANDOM_AVX2
+
+    #if defined(LU_COMPILER_MSVC)
+        #include <intrin.h>
+        #define LU_RANDOM_AVX2_TARGET
+    #else
+        #define LU_RANDOM_AVX2_TARGET __attribute__((target("avx2")))
+    #endif
+#endif
+
+namespace
+{
+
+	using namespace Lumen;
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Lanes
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: xoshiro128**, State[i][lane] holds word i of every lane so a word of all lanes is one AVX2 register
+	struct Lanes
+	{
+	public:
+		alignas(32) uint32_t State[4][FastRandom::Lanes] = { };
+		bool Seeded = false;
+	};
+
+	thread_local Lanes s_Lanes = {};
+
+	using Block = std::array<uint32_t, FastRandom::Lanes>;
+
+	forceinline uint32_t RotateLeft(uint32_t value, int count)
+	{
+		return (value << count) | (value >> (32 - count));
+	}
+
+	forceinline void NextBlock(Block& block)
+	{
+		auto& [s0, s1, s2, s3] = s_Lanes.State;
+		for (size_t i = 0; i < FastRandom::Lanes; i++)
+		{
+			block[i] = RotateLeft(s1[i] * 5, 7) * 9;
+
+			uint32_t t = s1[i] << 9;
+			s2[i] ^= s0[i];
+			s3[i] ^= s1[i];
+			s1[i] ^= s2[i];
+			s0[i] ^= s3[i];
+			s2[i] ^= t;
+			s3[i] = RotateLeft(s3[i], 11);
+		}
+	}
+
+	// Note: Both paths must produce the exact same block
+	#if defined(LU_RANDOM_AVX2)
+	forceinline bool HasAVX2()
+	{
+		#if defined(__AVX2__)
+		return true;
+		#elif defined(LU_COMPILER_MSVC)
+		static const bool s_AVX2 = []()
+		{
+			std::array<int, 4> info = { };
+			__cpuid(info.data(), 0);
+			if (info[0] < 7)
+				return false;
+
+			// Note: The OS has to save the YMM registers as well (OSXSAVE & AVX, then XCR0)
+			__cpuid(info.data(), 1);
+			if (((info[2] & (1 << 27)) == 0) || ((info[2] & (1 << 28)) == 0) || ((_xgetbv(0) & 0x6) != 0x6))
+				return false;
+
+			__cpuidex(info.data(), 7, 0);
+			return ((info[1] & (1 << 5)) != 0);
+		}();
+		return s_AVX2;
+		#else
+		static const bool s_AVX2 = []()
+		{
+			__builtin_cpu_init();
+			return (__builtin_cpu_supports("avx2") != 0);
+		}();
+		return s_AVX2;
+		#endif
+	}
+
+	LU_RANDOM_AVX2_TARGET forceinline __m256i RotateLeft(__m256i value, int count)
+	{
+		return _mm256_or_si256(_mm256_slli_epi32(value, count), _mm256_srli_epi32(value, 32 - count));
+	}
+
+	LU_RANDOM_AVX2_TARGET forceinline __m256i NextBlockAVX2()
+	{
+		__m256i* state = reinterpret_cast<__m256i*>(s_Lanes.State);
+		__m256i s0 = _mm256_load_si256(state + 0), s1 = _mm256_load_si256(state + 1);
+		__m256i s2 = _mm256_load_si256(state + 2), s3 = _mm256_load_si256(state + 3);
+
+		// Note: x * 5 and x * 9 as shift & add, AVX2 has no cheap 32 bit multiply
+		__m256i times5 = _mm256_add_epi32(s1, _mm256_slli_epi32(s1, 2));
+		__m256i rotated = RotateLeft(times5, 7);
+		__m256i result = _mm256_add_epi32(rotated, _mm256_slli_epi32(rotated, 3));
+
+		__m256i t = _mm256_slli_epi32(s1, 9);
+		s2 = _mm256_xor_si256(s2, s0);
+		s3 = _mm256_xor_si256(s3, s1);
+		s1 = _mm256_xor_si256(s1, s2);
+		s0 = _mm256_xor_si256(s0, s3);
+		s2 = _mm256_xor_si256(s2, t);
+		s3 = RotateLeft(s3, 11);
+
+		_mm256_store_si256(state + 0, s0); _mm256_store_si256(state + 1, s1);
+		_mm256_store_si256(state + 2, s2); _mm256_store_si256(state + 3, s3);
+
+		return result;
+	}
+	#endif
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Transforms
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: Runs transform on full blocks written straight to the output, the tail goes through a temporary block
+	template<typename T, typename TTransform>
+	forceinline void FillBlocks(std::span<T> values, TTransform&& transform)
+	{
+		constexpr size_t perBlock = (FastRandom::Lanes * sizeof(uint32_t)) / sizeof(T);
+
+		size_t full = values.size() - (values.size() % perBlock);
+		for (size_t i = 0; i < full; i += perBlock)
+			transform(values.data() + i);
+
+		if (full != values.size())
+		{
+			std::array<T, perBlock> tail = {};
+			transform(tail.data());
+			std::memcpy(values.data() + full, tail.data(), (values.size() - full) * sizeof(T));
+		}
+	}
+
+	#if defined(LU_RANDOM_AVX2)
+	// Note: Same as FillBlocks, but compiled with AVX2 so the transform inlines. Not forceinline, since the callers are compiled without it
+	template<typename T, typename TTransform>
+	LU_RANDOM_AVX2_TARGET void FillBlocksAVX2(std::span<T> values, TTransform&& transform)
+	{
+		constexpr size_t perBlock = (FastRandom::Lanes * sizeof(uint32_t)) / sizeof(T);
+
+		size_t full = values.size() - (values.size() % perBlock);
+		for (size_t i = 0; i < full; i += perBlock)
+			transform(values.data() + i);
+
+		if (full != values.size())
+		{
+			alignas(32) std::array<T, perBlock> tail = {};
+			transform(tail.data());
+			std::memcpy(values.data() + full, tail.data(), (values.size() - full) * sizeof(T));
+		}
+	}
+	#endif
+
+}
+
+namespace Lumen
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Batch
+	////////////////////////////////////////////////////////////////////////////////////
+	void FastRandom::Fill(std::span<float> values, float min, float max)
+	{
+		LU_PROFILE("FastRandom::Fill(float)");
+		if (!s_Lanes.Seeded) [[unlikely]]
+			SeedLanes(Next());
+
+		// Note: The top 24 bits fill the mantissa exactly, like FastRandom::Float
+		const float scale = 0x1.0p-24f * (max - min);
+
+		#if defined(LU_RANDOM_AVX2)
+		if (HasAVX2()) [[likely]]
+		{
+			FillBlocksAVX2(values, [&](float* out) LU_RANDOM_AVX2_TARGET
+			{
+				__m256 unit = _mm256_cvtepi32_ps(_mm256_srli_epi32(NextBlockAVX2(), 8));
+				_mm256_storeu_ps(out, _mm256_add_ps(_mm256_mul_ps(unit, _mm256_set1_ps(scale)), _mm256_set1_ps(min)));
+			});
+			return;
+		}
+		#endif
+
+		FillBlocks(values, [&](float* out)
+		{
+			Block block;
+			NextBlock(block);
+
+			for (size_t i = 0; i < Lanes; i++)
+				out[i] = static_cast<float>(block[i] >> 8) * scale + min;
+		});
+	}
+
+	void FastRandom::Fill(std::span<double> values, double min, double max)
+	{
+		LU_PROFILE("FastRandom::Fill(double)");
+		if (!s_Lanes.Seeded) [[unlikely]]
+			SeedLanes(Next());
+
+		// Note: Two lanes form one 64 bit value, its top 52 bits become the mantissa of a double in [1, 2).
+		//       This avoids a 64 bit integer conversion, which AVX2 doesn't have.
+		constexpr uint64_t one = 0x3FF0000000000000ULL;
+		const double range = max - min;
+
+		#if defined(LU_RANDOM_AVX2)
+		if (HasAVX2()) [[likely]]
+		{
+			FillBlocksAVX2(values, [&](double* out) LU_RANDOM_AVX2_TARGET
+			{
+				__m256i bits = _mm256_or_si256(_mm256_srli_epi64(NextBlockAVX2(), 12), _mm256_set1_epi64x(static_cast<int64_t>(one)));
+				__m256d unit = _mm256_sub_pd(_mm256_castsi256_pd(bits), _mm256_set1_pd(1.0));
+				_mm256_storeu_pd(out, _mm256_add_pd(_mm256_mul_pd(unit, _mm256_set1_pd(range)), _mm256_set1_pd(min)));
+			});
+			return;
+		}
+		#endif
+
+		FillBlocks(values, [&](double* out)
+		{
+			Block block;
+			NextBlock(block);
+
+			for (size_t i = 0; i < Lanes / 2; i++)
+			{
+				uint64_t bits = (static_cast<uint64_t>(block[i * 2 + 1]) << 32) | block[i * 2];
+				double unit = std::bit_cast<double>((bits >> 12) | one) - 1.0;
+				out[i] = unit * range + min;
+			}
+		});
+	}
+
+	void FastRandom::Fill(std::span<int32_t> values, int32_t min, int32_t max)
+	{
+		LU_PROFILE("FastRandom::Fill(int32_t)");
+
+		// Note: Same mapping as FastRandom::Int, the offset wraps around in unsigned space
+		std::span<uint32_t> bits(reinterpret_cast<uint32_t*>(values.data()), values.size());
+		Fill(bits, static_cast<uint32_t>(min), static_cast<uint32_t>(min) + static_cast<uint32_t>(static_cast<int64_t>(max) - min));
+	}
+
+	void FastRandom::Fill(std::span<uint32_t> values, uint32_t min, uint32_t max)
+	{
+		LU_PROFILE("FastRandom::Fill(uint32_t)");
+		if (!s_Lanes.Seeded) [[unlikely]]
+			SeedLanes(Next());
+
+		// Note: Handles the wrapped range from Fill(int32_t) as well, since (max - min) is taken modulo 2^32
+		const uint32_t span = max - min;
+		if (span == std::numeric_limits<uint32_t>::max())
+		{
+			FillBlocks(values, [&](uint32_t* out)
+			{
+				Block block;
+				NextBlock(block);
+				std::memcpy(out, block.data(), sizeof(block));
+			});
+			return;
+		}
+
+		// Note: Lemire's multiply-shift, a lane whose low product falls below the threshold is biased
+		//       and is redrawn with FastRandom::Bounded. This happens with a chance of bound / 2^32 at most.
+		const uint32_t bound = span + 1;
+		const uint32_t threshold = (0u - bound) % bound;
+
+		#if defined(LU_RANDOM_AVX2)
+		if (HasAVX2()) [[likely]]
+		{
+			FillBlocksAVX2(values, [&](uint32_t* out) LU_RANDOM_AVX2_TARGET
+			{
+				const __m256i boundLanes = _mm256_set1_epi32(static_cast<int32_t>(bound));
+				__m256i value = NextBlockAVX2();
+
+				// Note: _mm256_mul_epu32 only multiplies the even lanes, the odd lanes are shifted down
+				__m256i even = _mm256_mul_epu32(value, boundLanes);
+				__m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), boundLanes);
+
+				__m256i high = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0b10101010);
+				__m256i low = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0b10101010);
+
+				// Note: low >= threshold, unsigned
+				__m256i accepted = _mm256_cmpeq_epi32(_mm256_max_epu32(low, _mm256_set1_epi32(static_cast<int32_t>(threshold))), low);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_add_epi32(high, _mm256_set1_epi32(static_cast<int32_t>(min))));
+
+				uint32_t rejected = ~static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(accepted))) & 0xFF;
+				while (rejected) [[unlikely]]
+				{
+					int lane = std::countr_zero(rejected);
+					out[lane] = min + Bounded(bound);
+					rejected &= rejected - 1;
+				}
+			});
+			return;
+		}
+		#endif
+
+		FillBlocks(values, [&](uint32_t* out)
+		{
+			Block block;
+			NextBlock(block);
+
+			for (size_t i = 0; i < Lanes; i++)
+			{
+				uint64_t product = static_cast<uint64_t>(block[i]) * bound;
+				out[i] = min + static_cast<uint32_t>(product >> 32);
+			}
+
+			for (size_t i = 0; i < Lanes; i++)
+			{
+				if (static_cast<uint32_t>(static_cast<uint64_t>(block[i]) * bound) < threshold) [[unlikely]]
+					out[i] = min + Bounded(bound);
+			}
+		});
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Private methods
+	////////////////////////////////////////////////////////////////////////////////////
+	void FastRandom::SeedLanes(uint64_t seed)
+	{
+		// Note: Every lane gets its own SplitMix64 output, so no lane starts at the all-zero state
+		uint64_t state = seed;
+		for (size_t lane = 0; lane < Lanes; lane++)
+		{
+			for (size_t i = 0; i < 4; i += 2)
+			{
+				state += 0x9E3779B97F4A7C15ULL;
+				uint64_t z = state;
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+				z ^= (z >> 31);
+
+				s_Lanes.State[i][lane] = static_cast<uint32_t>(z);
+				s_Lanes.State[i + 1][lane] = static_cast<uint32_t>(z >> 32);
+			}
+
+			if ((s_Lanes.State[0][lane] | s_Lanes.State[1][lane] | s_Lanes.State[2][lane] | s_Lanes.State[3][lane]) == 0) [[unlikely]]
+				s_Lanes.State[0][lane] = 1;
+		}
+
+		s_Lanes.Seeded = true;
+	}
+
+}
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "Lumen/Core/Core.hpp"
 
+#include <span>
 #include <cstdint>
 #include <array>
 #include <chrono>
@@ -49,17 +50,20 @@ namespace Lumen
     ////////////////////////////////////////////////////////////////////////////////////
     class FastRandom
     {
+    public:
+        // Settings
+        inline constexpr static const size_t Lanes = 8; // Note: Independent generators used by Fill, 8 x 32 bits is one AVX2 register
     public:
         // Seeding
 		static void Seed();
-		static void Seed(uint64_t seed);
+		static void Seed(uint64_t seed); // Note: Also reseeds the Fill lanes of this thread
 
         // Floating point
-        static float Float(float min = 0.0f, float max = 1.0f);
-        static double Double(double min = 0.0, double max = 1.0);
+        static float Float(float min = 0.0f, float max = 1.0f);   // Note: [min, max)
+        static double Double(double min = 0.0, double max = 1.0); // Note: [min, max)
 
         // Integer
-        static int32_t Int(int32_t min = std::numeric_limits<int32_t>::min(), int32_t max = std::numeric_limits<int32_t>::max());
+        static int32_t Int(int32_t min = std::numeric_limits<int32_t>::min(), int32_t max = std::numeric_limits<int32_t>::max()); // Note: [min, max], unbiased
         static uint32_t UInt(uint32_t min = std::numeric_limits<uint32_t>::min(), uint32_t max = std::numeric_limits<uint32_t>::max());
 
         // Boolean
@@ -68,9 +72,17 @@ namespace Lumen
         // Utils
         static bool Chance(float percentage);
 
+        // Batch (Note: Same ranges as above, generated by xoshiro128** lanes, with AVX2 when the CPU supports it. Much faster for large spans)
+        static void Fill(std::span<float> values, float min = 0.0f, float max = 1.0f);
+        static void Fill(std::span<double> values, double min = 0.0, double max = 1.0);
+        static void Fill(std::span<int32_t> values, int32_t min = std::numeric_limits<int32_t>::min(), int32_t max = std::numeric_limits<int32_t>::max());
+        static void Fill(std::span<uint32_t> values, uint32_t min = std::numeric_limits<uint32_t>::min(), uint32_t max = std::numeric_limits<uint32_t>::max());
+
     private:
         // Private methods
         static uint64_t Next();
+        static uint32_t Bounded(uint64_t range); // Note: Lemire's multiply-shift with rejection, range may be up to 2^32
+        static void SeedLanes(uint64_t seed);    // Note: Defined in Random.cpp
         static uint64_t NextXORShift64();   // Very fast, low quality
         static uint64_t NextSplitMix64();   // Great for seeding
         static uint64_t NextPCG32();        // Great balance, highly recommended
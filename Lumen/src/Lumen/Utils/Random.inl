@@ -8,7 +8,7 @@ namespace Lumen
 	inline thread_local std::uniform_real_distribution<float>		Random::s_FloatDist(0.0f, 1.0f);
 	inline thread_local std::uniform_real_distribution<double>		Random::s_DoubleDist(0.0, 1.0);
 
-	inline thread_local uint64_t									FastRandom::s_State = static_cast<uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+	inline thread_local uint64_t									FastRandom::s_State = 0; // Note: Constant initialized, so accesses skip the thread_local init guard. Seeded on first use.
 
 	////////////////////////////////////////////////////////////////////////////////////
 	// Seeding
@@ -81,7 +81,13 @@ namespace Lumen
 
 	forceinline void FastRandom::Seed(uint64_t seed)
 	{
+		// Note: Zero is a fixed point of xorshift, so the seed is scrambled first
 		s_State = seed;
+		s_State = NextSplitMix64();
+		if (s_State == 0)
+			s_State = 0x9E3779B97F4A7C15ULL;
+
+		SeedLanes(seed);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -90,13 +96,13 @@ namespace Lumen
 	forceinline float FastRandom::Float(float min, float max)
 	{
 		LU_PROFILE("FastRandom::Float()");
-		return min + (Next() / static_cast<float>(std::numeric_limits<uint32_t>::max())) * (max - min);
+		return min + static_cast<float>(Next() >> 40) * 0x1.0p-24f * (max - min); // Note: The top 24 bits fill the mantissa exactly
 	}
 
 	forceinline double FastRandom::Double(double min, double max)
 	{
 		LU_PROFILE("FastRandom::Double()");
-		return min + (Next() / static_cast<double>(std::numeric_limits<uint32_t>::max())) * (max - min);
+		return min + static_cast<double>(Next() >> 11) * 0x1.0p-53 * (max - min);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -105,13 +111,13 @@ namespace Lumen
 	forceinline int32_t FastRandom::Int(int32_t min, int32_t max)
 	{
 		LU_PROFILE("FastRandom::Int()");
-		return min + static_cast<int32_t>(Next() % (static_cast<uint32_t>(max - min + 1)));
+		return static_cast<int32_t>(static_cast<uint32_t>(min) + Bounded(static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1));
 	}
 
 	forceinline uint32_t FastRandom::UInt(uint32_t min, uint32_t max)
 	{
 		LU_PROFILE("FastRandom::UInt()");
-		return min + (Next() % (max - min + 1));
+		return min + Bounded(static_cast<uint64_t>(max - min) + 1);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -137,9 +143,38 @@ namespace Lumen
 	////////////////////////////////////////////////////////////////////////////////////
 	forceinline uint64_t FastRandom::Next() // Note: Can be changed to a different FastRandom method
 	{
+		// Note: Seed never leaves the state at zero, so zero means this thread hasn't been seeded yet
+		if (s_State == 0) [[unlikely]]
+			Seed();
+
 		return NextXORShift64();
 	}
 
+	forceinline uint32_t FastRandom::Bounded(uint64_t range)
+	{
+		// Note: The high bits, since the low bits of xorshift are the weakest
+		uint32_t value = static_cast<uint32_t>(Next() >> 32);
+		if (range > std::numeric_limits<uint32_t>::max()) [[unlikely]]
+			return value;
+
+		uint32_t bound = static_cast<uint32_t>(range);
+		uint64_t product = static_cast<uint64_t>(value) * bound;
+		uint32_t low = static_cast<uint32_t>(product);
+
+		// Note: Only products in the first 2^32 % bound values of a bucket are biased, so this rarely loops
+		if (low < bound) [[unlikely]]
+		{
+			uint32_t threshold = (0u - bound) % bound;
+			while (low < threshold)
+			{
+				product = static_cast<uint64_t>(static_cast<uint32_t>(Next() >> 32)) * bound;
+				low = static_cast<uint32_t>(product);
+			}
+		}
+
+		return static_cast<uint32_t>(product >> 32);
+	}
+
 	hintinline uint64_t FastRandom::NextXORShift64()
 	{
 		s_State ^= s_State << 13;
@@ -1,9 +1,17 @@
 #include <iostream>
+#include <span>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <string_view>
 
 #include "Lumen/Internal/Core/Window.hpp"
 
 #include "Lumen/Internal/IO/Print.hpp"
 #include "Lumen/Internal/Utils/Settings.hpp"
+#include "Lumen/Internal/Utils/FrameStatistics.hpp"
+#include "Lumen/Internal/Utils/Profiler.hpp"
 
 #include "Lumen/Internal/Memory/DeferredConstruct.hpp"
 
@@ -11,6 +19,9 @@ using namespace Lumen;
 
 int Main(int argc, char* argv[])
 {
+	// Note: With --threaded-input the main thread only polls, while events are dispatched & frames rendered/presented on a separate thread
+	bool threadedInput = std::ranges::any_of(std::span(argv, static_cast<size_t>(argc)), [](const char* arg) { return (std::string_view(arg) == "--threaded-input"); });
+
 	Internal::DeferredConstruct<Internal::Window> window;
 	window.Construct(Internal::WindowSpecification({
 		.Title = "Lumen", 
@@ -18,40 +29,104 @@ int Main(int argc, char* argv[])
 		.Width = 1280,
 		.Height = 720,
 
-		.EventCallback = [&](Event event) -> void 
+		.EventCallback = [&](Event& event) -> void 
 		{ 
-			EventHandler handler(event);
-			handler.Handle<WindowCloseEvent>([&](WindowCloseEvent&) -> void { window->Close(); });
-			handler.Handle<WindowResizeEvent>([&](WindowResizeEvent& e) -> void { window->Resize(e.GetWidth(), e.GetHeight()); });
+			EventDispatcher::Dispatch(event,
+				[&](WindowCloseEvent&) -> void { window->Close(); },
+				[&](WindowResizeEvent& e) -> void { window->Resize(e.GetWidth(), e.GetHeight()); } // Note: Delivered on the rendering thread, so it may touch the renderer
+			);
 		},
+		.ThreadedInput = threadedInput,
 
 		.VSync = true,
 	}));
 
+	// Note: Frame graphs live in the frame arena, so once every frame in flight has been used, building & baking
+	//       one must not touch the heap. Counted through the memory tags, so this only checks with LU_MEM_PROFILING,
+	//       the FrameArena benchmark checks the same thing in every configuration
+	uint64_t frameCount = 0;
+	[[maybe_unused]] uint64_t graphAllocations = 0;
+
 	double lastTime = window->GetTime();
 	double deltaTime = 0.0f;
 	double timer = 0.0f;
-	uint32_t frameCount = 0;
 
-	while (window->IsOpen())
+	// Note: The title may only be set from the main thread, so the rendering thread publishes the FPS
+	std::atomic<uint32_t> fps = 0;
+	uint32_t titleFPS = 0;
+
+	auto renderFrame = [&]() -> void
 	{
-		window->PollEvents();
+		if (!window->IsMinimized())
+		{
+			Internal::Renderer& renderer = window->GetRenderer();
+
+			renderer.BeginFrame();
+			{
+				LU_MEM_TAG(Renderer);
+				uint64_t allocations = Internal::MemoryTagScope::GetStatistics(Internal::MemoryTag::Renderer).Allocations;
+
+				Internal::Waitable acquire(Internal::WaitOperation::AcquireImage);
+
+				Internal::FrameGraph graph = renderer.CreateFrameGraph();
+				graph.Elements.emplace_back(Internal::CommandBufferHandle(), Internal::Queue::Graphics, std::span<const Internal::Waitable>(&acquire, 1));
+				renderer.BakeCurrentFrameGraph(graph);
+
+				if (++frameCount > Internal::RendererSpecification::MaxFramesInFlight)
+					graphAllocations += Internal::MemoryTagScope::GetStatistics(Internal::MemoryTag::Renderer).Allocations - allocations;
+
+				LU_ASSERT((graphAllocations == 0), "[Sandbox] Building & baking a frame graph allocated from the heap.");
+			}
+			renderer.EndFrame();
+			renderer.Present();
+		}
 
 		window->SwapBuffers();
 
 		deltaTime = window->GetTime() - lastTime;
 		lastTime = window->GetTime();
 		timer += deltaTime;
-		frameCount++;
 
 		if (timer >= 1.0f)
 		{
-			LU_LOG_INFO("FPS: {0}", frameCount);
-			window->SetTitle(std::format("Lumen - FPS: {0}", frameCount));
+			Internal::FramePercentiles cpu = Internal::FrameStatistics::GetPercentiles(Internal::FrameMetric::CPUTime);
+			Internal::FramePercentiles gpu = Internal::FrameStatistics::GetPercentiles(Internal::FrameMetric::GPUTime);
+			fps.store(((cpu.P50 > 0.0) ? static_cast<uint32_t>(1000.0 / cpu.P50) : 0), std::memory_order_relaxed);
+
+			LU_LOG_INFO("FPS: {0}, CPU: {1:.2f}ms (p99 {2:.2f}ms), GPU: {3:.2f}ms (p99 {4:.2f}ms), Latency: {5:.2f}ms", fps.load(std::memory_order_relaxed), cpu.P50, cpu.P99, gpu.P50, gpu.P99, window->GetRenderer().GetLatencyStatistics().Latency);
 			timer = 0.0f;
-			frameCount = 0;
+		}
+	};
+
+	std::jthread renderThread;
+	if (threadedInput)
+	{
+		renderThread = std::jthread([&](std::stop_token token)
+		{
+			while (!token.stop_requested() && window->IsOpen())
+			{
+				window->DispatchEvents();
+				renderFrame();
+			}
+		});
+	}
+
+	while (window->IsOpen())
+	{
+		window->PollEvents();
+
+		// Note: Polling isn't held up by presenting, so it doesn't need to spin faster than the input it picks up
+		if (threadedInput)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		else
+			renderFrame();
+
+		if (uint32_t current = fps.load(std::memory_order_relaxed); current != titleFPS)
+		{
+			titleFPS = current;
+			window->SetTitle(std::format("Lumen - FPS: {0}", titleFPS));
 		}
 	}
 
-	return 0;
+	return 0; // Note: The rendering thread is stopped & joined before the window is destroyed
 }
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Lumen/Core/Core.hpp"
+
+#include <chrono>
+#include <format>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <iostream>
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+
+#if defined(LU_COMPILER_MSVC)
+	#include <intrin.h>
+#endif
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Settings
+	////////////////////////////////////////////////////////////////////////////////////
+	inline constexpr const size_t Repeats = 5; // Note: The fastest repeat is reported, the others absorb warmup & noise
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Helper functions
+	////////////////////////////////////////////////////////////////////////////////////
+	template<typename T>
+	forceinline void DoNotOptimize(const T& value) // Note: Makes the compiler assume value is read, so the work producing it is kept
+	{
+		#if defined(LU_COMPILER_MSVC)
+		static volatile const void* s_Sink = nullptr;
+		s_Sink = &value;
+		_ReadWriteBarrier();
+		#else
+		asm volatile("" : : "r,m"(value) : "memory");
+		#endif
+	}
+
+	forceinline double Now() // Note: In nanoseconds
+	{
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	template<typename TFunc>
+	double Measure(size_t iterations, TFunc&& func) // Note: Returns nanoseconds per iteration of the fastest repeat
+	{
+		double best = std::numeric_limits<double>::max();
+		for (size_t repeat = 0; repeat < Repeats; repeat++)
+		{
+			double start = Now();
+			for (size_t i = 0; i < iterations; i++)
+				func(i);
+
+			best = std::min(best, (Now() - start) / static_cast<double>(iterations));
+		}
+
+		return best;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Output
+	////////////////////////////////////////////////////////////////////////////////////
+	inline void Header(std::string_view suite)
+	{
+		std::cout << std::format("\n{}\n{}\n", suite, std::string(suite.size(), '-'));
+	}
+
+	inline void Report(std::string_view name, double nanoseconds, std::string_view note = {})
+	{
+		std::cout << std::format("  {:<56} {:>12.2f} ns  {}\n", name, nanoseconds, note);
+	}
+
+	inline void ReportThroughput(std::string_view name, double nanoseconds, size_t bytes)
+	{
+		std::cout << std::format("  {:<56} {:>12.2f} ns  {:.2f} GiB/s\n", name, nanoseconds, (static_cast<double>(bytes) / nanoseconds) * (1'000'000'000.0 / (1024.0 * 1024.0 * 1024.0)));
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Checks
+	////////////////////////////////////////////////////////////////////////////////////
+	inline bool g_Failed = false; // Note: Makes the run exit with 1, for checks done alongside the measurements
+
+	inline void Fail(std::string_view name, std::string_view reason)
+	{
+		std::cout << std::format("  {:<56} FAILED, {}\n", name, reason);
+		g_Failed = true;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Suites
+	////////////////////////////////////////////////////////////////////////////////////
+	void RunEventBenchmarks();
+	void RunLoggingBenchmarks();
+	void RunBinaryLoggingBenchmarks();
+	void RunEnumBenchmarks();
+	void RunEnumReflectionBenchmarks();
+	void RunHashBenchmarks();
+	void RunFlatHashMapBenchmarks();
+	void RunRandomBenchmarks();
+	void RunFrameArenaBenchmarks();
+	void RunFramesInFlightBenchmarks();
+
+}
\ No newline at end of file
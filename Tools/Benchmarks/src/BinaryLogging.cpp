@@ -0,0 +1,63 @@
+#include "Benchmark.hpp"
+
+#include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/IO/BinaryLog.hpp"
+
+#include <string>
+#include <cstdint>
+#include <iostream>
+#include <streambuf>
+#include <filesystem>
+
+namespace
+{
+
+	class NullBuffer : public std::streambuf // Note: Only written to if LU_LOG_TRACE is enabled in this configuration
+	{
+	protected:
+		int overflow(int c) override { return c; }
+		std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+	};
+
+}
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Binary logging
+	////////////////////////////////////////////////////////////////////////////////////
+	void RunBinaryLoggingBenchmarks()
+	{
+		using namespace Lumen::Internal;
+
+		// Note: Well below the file's capacity, so no record is dropped
+		constexpr size_t iterations = 1 << 16;
+
+		NullBuffer null;
+		std::streambuf* console = std::cout.rdbuf(&null);
+		double trace = Measure(iterations, []([[maybe_unused]] size_t i) { LU_LOG_TRACE("Frame {0} took {1:.2f}ms on the {2} queue", i, 16.6, "graphics"); });
+		Log::Logger::Flush();
+		std::cout.rdbuf(console);
+
+		double closed = Measure(iterations, [](size_t i) { LU_LOG_BINARY("Frame {0} took {1:.2f}ms on the {2} queue", i, 16.6, "graphics"); });
+
+		std::filesystem::path path = std::filesystem::temp_directory_path() / "LumenBenchmark.lublog";
+		if (!Log::BinaryLog::Open(path.string()))
+		{
+			std::cout << std::format("  Failed to open '{}', skipping the open sink.\n", path.string());
+			return;
+		}
+
+		double open = Measure(iterations, [](size_t i) { LU_LOG_BINARY("Frame {0} took {1:.2f}ms on the {2} queue", i, 16.6, "graphics"); });
+		uint64_t dropped = Log::BinaryLog::GetDropped();
+
+		Log::BinaryLog::Close();
+		std::filesystem::remove(path);
+
+		Report("LU_LOG_TRACE", trace, ((LU_LOG_MIN_LEVEL > 0) ? "per call, filtered at compile time" : "per call, enabled in this configuration"));
+		Report("LU_LOG_BINARY, sink closed", closed, "per call");
+		Report("LU_LOG_BINARY, sink open", open, std::format("per call, {} dropped", dropped));
+	}
+
+}
\ No newline at end of file
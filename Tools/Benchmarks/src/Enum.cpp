@@ -0,0 +1,108 @@
+#include "Benchmark.hpp"
+
+#include "Lumen/Enum/Name.hpp"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Enums
+	////////////////////////////////////////////////////////////////////////////////////
+	enum class Dense : uint8_t
+	{
+		Element00, Element01, Element02, Element03, Element04, Element05, Element06, Element07,
+		Element08, Element09, Element10, Element11, Element12, Element13, Element14, Element15,
+		Element16, Element17, Element18, Element19, Element20, Element21, Element22, Element23,
+		Element24, Element25, Element26, Element27, Element28, Element29, Element30, Element31,
+		Element32, Element33, Element34, Element35, Element36, Element37, Element38, Element39,
+		Element40, Element41, Element42, Element43, Element44, Element45, Element46, Element47,
+		Element48, Element49, Element50, Element51, Element52, Element53, Element54, Element55,
+		Element56, Element57, Element58, Element59, Element60, Element61, Element62, Element63
+	};
+
+	enum class Bitwise : uint32_t
+	{
+		None = 0,
+		Bit00 = 1u << 0, Bit01 = 1u << 1, Bit02 = 1u << 2, Bit03 = 1u << 3, Bit04 = 1u << 4, Bit05 = 1u << 5, Bit06 = 1u << 6, Bit07 = 1u << 7,
+		Bit08 = 1u << 8, Bit09 = 1u << 9, Bit10 = 1u << 10, Bit11 = 1u << 11, Bit12 = 1u << 12, Bit13 = 1u << 13, Bit14 = 1u << 14, Bit15 = 1u << 15,
+		Bit16 = 1u << 16, Bit17 = 1u << 17, Bit18 = 1u << 18, Bit19 = 1u << 19, Bit20 = 1u << 20, Bit21 = 1u << 21, Bit22 = 1u << 22, Bit23 = 1u << 23,
+		Bit24 = 1u << 24, Bit25 = 1u << 25, Bit26 = 1u << 26, Bit27 = 1u << 27, Bit28 = 1u << 28, Bit29 = 1u << 29, Bit30 = 1u << 30, Bit31 = 1u << 31
+	};
+
+}
+
+template<>
+struct Lumen::Enum::Customize<Bitwise>
+{
+public:
+	inline static constexpr bool Bitwise = true;
+};
+
+namespace
+{
+
+	using namespace Lumen;
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Helpers
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: The linear Name scan from before the lookup tables, with a matching scan for Cast to compare against
+	template<typename TEnum>
+	std::string_view NameLinear(const TEnum value)
+	{
+		for (const auto& [val, name] : Internal::Enum::Entries<TEnum>)
+		{
+			if (val == value)
+				return name;
+		}
+
+		return {};
+	}
+
+	template<typename TEnum>
+	std::optional<TEnum> CastLinear(std::string_view name)
+	{
+		for (const auto& [val, n] : Internal::Enum::Entries<TEnum>)
+		{
+			if (n == name)
+				return val;
+		}
+
+		return std::nullopt;
+	}
+
+	template<typename TEnum>
+	void RunEnum(std::string_view enumName)
+	{
+		constexpr const auto& entries = Internal::Enum::Entries<TEnum>;
+		constexpr size_t iterations = 1 << 22;
+
+		// Note: Strided through the entries, so the branch predictor can't learn a fixed position
+		auto index = [](size_t i) { return (i * 7) % entries.size(); };
+
+		Benchmarks::Report(std::format("{} ({} entries): Name, linear scan (previous)", enumName, entries.size()), Benchmarks::Measure(iterations, [&](size_t i) { Benchmarks::DoNotOptimize(NameLinear(entries[index(i)].first)); }), "per call");
+		Benchmarks::Report(std::format("{} ({} entries): Enum::Name", enumName, entries.size()), Benchmarks::Measure(iterations, [&](size_t i) { Benchmarks::DoNotOptimize(Enum::Name(entries[index(i)].first)); }), "per call");
+		Benchmarks::Report(std::format("{} ({} entries): Cast, linear scan", enumName, entries.size()), Benchmarks::Measure(iterations, [&](size_t i) { Benchmarks::DoNotOptimize(CastLinear<TEnum>(entries[index(i)].second)); }), "per call");
+		Benchmarks::Report(std::format("{} ({} entries): Enum::Cast", enumName, entries.size()), Benchmarks::Measure(iterations, [&](size_t i) { Benchmarks::DoNotOptimize(Enum::Cast<TEnum>(entries[index(i)].second)); }), "per call");
+	}
+
+}
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Enum
+	////////////////////////////////////////////////////////////////////////////////////
+	void RunEnumBenchmarks()
+	{
+		RunEnum<Dense>("Dense");
+		RunEnum<Bitwise>("Bitwise");
+	}
+
+}
\ No newline at end of file
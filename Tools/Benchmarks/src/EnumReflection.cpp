@@ -0,0 +1,134 @@
+#include "Benchmark.hpp"
+
+#include "Lumen/Enum/Name.hpp"
+
+#include <format>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+
+// Note: This file is the compile-time benchmark for enum reflection. Time its compilation,
+//       the suite itself only reports what was reflected so the instantiations are kept.
+namespace
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Enums
+	////////////////////////////////////////////////////////////////////////////////////
+	enum class ReflectedA : uint8_t
+	{
+		A00, A01, A02, A03, A04, A05, A06, A07,
+		A08, A09, A10, A11, A12, A13, A14, A15,
+		A16, A17, A18, A19, A20, A21, A22, A23,
+		A24, A25, A26, A27, A28, A29, A30, A31,
+		A32, A33, A34, A35, A36, A37, A38, A39
+	};
+
+	enum class ReflectedB : uint8_t
+	{
+		B00, B01, B02, B03, B04, B05, B06, B07,
+		B08, B09, B10, B11, B12, B13, B14, B15,
+		B16, B17, B18, B19, B20, B21, B22, B23,
+		B24, B25, B26, B27, B28, B29, B30, B31,
+		B32, B33, B34, B35, B36, B37, B38, B39
+	};
+
+	enum class ReflectedC : uint8_t
+	{
+		C00, C01, C02, C03, C04, C05, C06, C07,
+		C08, C09, C10, C11, C12, C13, C14, C15,
+		C16, C17, C18, C19, C20, C21, C22, C23,
+		C24, C25, C26, C27, C28, C29, C30, C31,
+		C32, C33, C34, C35, C36, C37, C38, C39
+	};
+
+	enum class ReflectedD : uint8_t
+	{
+		D00, D01, D02, D03, D04, D05, D06, D07,
+		D08, D09, D10, D11, D12, D13, D14, D15,
+		D16, D17, D18, D19, D20, D21, D22, D23,
+		D24, D25, D26, D27, D28, D29, D30, D31,
+		D32, D33, D34, D35, D36, D37, D38, D39
+	};
+
+	enum class ReflectedE : uint8_t
+	{
+		E00, E01, E02, E03, E04, E05, E06, E07,
+		E08, E09, E10, E11, E12, E13, E14, E15,
+		E16, E17, E18, E19, E20, E21, E22, E23,
+		E24, E25, E26, E27, E28, E29, E30, E31,
+		E32, E33, E34, E35, E36, E37, E38, E39
+	};
+
+	enum class ReflectedF : uint8_t
+	{
+		F00, F01, F02, F03, F04, F05, F06, F07,
+		F08, F09, F10, F11, F12, F13, F14, F15,
+		F16, F17, F18, F19, F20, F21, F22, F23,
+		F24, F25, F26, F27, F28, F29, F30, F31,
+		F32, F33, F34, F35, F36, F37, F38, F39
+	};
+
+	enum class ReflectedG : uint8_t
+	{
+		G00, G01, G02, G03, G04, G05, G06, G07,
+		G08, G09, G10, G11, G12, G13, G14, G15,
+		G16, G17, G18, G19, G20, G21, G22, G23,
+		G24, G25, G26, G27, G28, G29, G30, G31,
+		G32, G33, G34, G35, G36, G37, G38, G39
+	};
+
+	enum class ReflectedH : uint8_t
+	{
+		H00, H01, H02, H03, H04, H05, H06, H07,
+		H08, H09, H10, H11, H12, H13, H14, H15,
+		H16, H17, H18, H19, H20, H21, H22, H23,
+		H24, H25, H26, H27, H28, H29, H30, H31,
+		H32, H33, H34, H35, H36, H37, H38, H39
+	};
+
+	enum class ReflectedWide : int16_t
+	{
+		Minimum = -1000, Negative = -500, Zero = 0, Positive = 500, Maximum = 1000
+	};
+
+}
+
+template<>
+struct Lumen::Enum::Range<ReflectedWide>
+{
+public:
+	inline static constexpr int32_t Min = -1000;
+	inline static constexpr int32_t Max = 1000;
+};
+
+namespace
+{
+
+	void ReportEntries(std::string_view enumName, size_t entries)
+	{
+		std::cout << std::format("  {:<56} {:>12} entries\n", enumName, entries);
+	}
+
+}
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Enum reflection
+	////////////////////////////////////////////////////////////////////////////////////
+	void RunEnumReflectionBenchmarks()
+	{
+		ReportEntries("ReflectedA", Internal::Enum::Entries<ReflectedA>.size());
+		ReportEntries("ReflectedB", Internal::Enum::Entries<ReflectedB>.size());
+		ReportEntries("ReflectedC", Internal::Enum::Entries<ReflectedC>.size());
+		ReportEntries("ReflectedD", Internal::Enum::Entries<ReflectedD>.size());
+		ReportEntries("ReflectedE", Internal::Enum::Entries<ReflectedE>.size());
+		ReportEntries("ReflectedF", Internal::Enum::Entries<ReflectedF>.size());
+		ReportEntries("ReflectedG", Internal::Enum::Entries<ReflectedG>.size());
+		ReportEntries("ReflectedH", Internal::Enum::Entries<ReflectedH>.size());
+		ReportEntries("ReflectedWide (2001 value range)", Internal::Enum::Entries<ReflectedWide>.size());
+	}
+
+}
\ No newline at end of file
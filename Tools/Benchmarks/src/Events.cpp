@@ -0,0 +1,77 @@
+#include "Benchmark.hpp"
+
+#include "Lumen/Core/Events.hpp"
+#include "Lumen/Internal/Memory/InplaceFunction.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Events
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: Compares the previous callback (std::function taking the Event by value, with one
+	//       EventHandler::Handle per handled type) to InplaceFunction & EventDispatcher::Dispatch.
+	void RunEventBenchmarks()
+	{
+		constexpr size_t eventCount = 4096;
+
+		std::vector<Event> events;
+		events.reserve(eventCount);
+		for (size_t i = 0; i < eventCount; i++)
+		{
+			switch (i % 6)
+			{
+			case 0: events.emplace_back(MouseMovedEvent(static_cast<float>(i), static_cast<float>(i))); break;
+			case 1: events.emplace_back(KeyPressedEvent(static_cast<int>(i % 128), 0)); break;
+			case 2: events.emplace_back(KeyReleasedEvent(static_cast<int>(i % 128))); break;
+			case 3: events.emplace_back(MouseScrolledEvent(0.0f, 1.0f)); break;
+			case 4: events.emplace_back(WindowResizeEvent(static_cast<uint32_t>(i), static_cast<uint32_t>(i))); break;
+			case 5: events.emplace_back(MouseMovedEvent(0.0f, static_cast<float>(i))); break;
+			}
+		}
+
+		uint64_t sum = 0;
+
+		std::function<void(Event)> previous = [&](Event e)
+		{
+			EventHandler handler(e);
+			handler.Handle<WindowCloseEvent>([&](WindowCloseEvent&) { sum += 1; });
+			handler.Handle<WindowResizeEvent>([&](WindowResizeEvent& resize) { sum += resize.GetWidth(); });
+			handler.Handle<KeyPressedEvent>([&](KeyPressedEvent&) { sum += 3; });
+			handler.Handle<MouseMovedEvent>([&](MouseMovedEvent& moved) { sum += static_cast<uint64_t>(moved.GetX()); });
+		};
+
+		Internal::InplaceFunction<void(Event&)> current = [&](Event& e)
+		{
+			EventDispatcher::Dispatch(e,
+				[&](WindowCloseEvent&) { sum += 1; },
+				[&](WindowResizeEvent& resize) { sum += resize.GetWidth(); },
+				[&](KeyPressedEvent&) { sum += 3; },
+				[&](MouseMovedEvent& moved) { sum += static_cast<uint64_t>(moved.GetX()); }
+			);
+		};
+
+		Report("std::function<void(Event)> + 4x EventHandler::Handle", Measure(eventCount * 256, [&](size_t i) { previous(events[i % eventCount]); }), "per event");
+		Report("InplaceFunction<void(Event&)> + EventDispatcher::Dispatch", Measure(eventCount * 256, [&](size_t i) { current(events[i % eventCount]); }), "per event");
+
+		// Note: Three captured pointers don't fit in std::function's small buffer, so it allocates
+		uint64_t a = 1, b = 2, c = 3;
+		Report("Construct std::function (24 byte capture)", Measure(1 << 20, [&](size_t)
+		{
+			std::function<void(Event)> callback = [&a, &b, &c](Event) { a += b + c; };
+			DoNotOptimize(callback);
+		}));
+		Report("Construct InplaceFunction (24 byte capture)", Measure(1 << 20, [&](size_t)
+		{
+			Internal::InplaceFunction<void(Event&)> callback = [&a, &b, &c](Event&) { a += b + c; };
+			DoNotOptimize(callback);
+		}));
+
+		DoNotOptimize(sum);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "Benchmark.hpp"
+
+#include "Lumen/Internal/Memory/FlatHashMap.hpp"
+
+#include <array>
+#include <vector>
+#include <format>
+#include <cstdint>
+#include <unordered_map>
+
+namespace
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Helpers
+	////////////////////////////////////////////////////////////////////////////////////
+	uint64_t SplitMix(uint64_t& state) // Note: Scattered keys, like the pointers the engine uses as keys
+	{
+		uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+		return z ^ (z >> 31);
+	}
+
+}
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// FlatHashMap
+	////////////////////////////////////////////////////////////////////////////////////
+	void RunFlatHashMapBenchmarks()
+	{
+		using namespace Lumen::Internal;
+
+		constexpr std::array<size_t, 4> counts = { 1'000, 16'000, 256'000, 1'000'000 };
+
+		for (size_t count : counts)
+		{
+			uint64_t state = count;
+			std::vector<uint64_t> keys(count), missing(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				keys[i] = SplitMix(state);
+				missing[i] = SplitMix(state);
+			}
+
+			// Note: Lookups run over the keys in a different order than they were inserted in
+			std::vector<uint64_t> lookups = keys;
+			for (size_t i = count - 1; i > 0; i--)
+				std::swap(lookups[i], lookups[SplitMix(state) % (i + 1)]);
+
+			double perKey = 1.0 / static_cast<double>(count);
+			size_t findIterations = std::max<size_t>(count, 1 << 20);
+
+			std::unordered_map<uint64_t, uint64_t> unordered;
+			double unorderedInsert = Measure(1, [&](size_t)
+			{
+				unordered = {};
+				for (size_t i = 0; i < count; i++)
+					unordered[keys[i]] = i;
+			}) * perKey;
+			double unorderedHit = Measure(findIterations, [&](size_t i) { DoNotOptimize(unordered.find(lookups[i % count])); });
+			double unorderedMiss = Measure(findIterations, [&](size_t i) { DoNotOptimize(unordered.find(missing[i % count])); });
+
+			FlatHashMap<uint64_t, uint64_t> flat;
+			double flatInsert = Measure(1, [&](size_t)
+			{
+				flat = {};
+				for (size_t i = 0; i < count; i++)
+					flat[keys[i]] = i;
+			}) * perKey;
+			double flatHit = Measure(findIterations, [&](size_t i) { DoNotOptimize(flat.Find(lookups[i % count])); });
+			double flatMiss = Measure(findIterations, [&](size_t i) { DoNotOptimize(flat.Find(missing[i % count])); });
+
+			Report(std::format("std::unordered_map, {} keys: insert", count), unorderedInsert, "per key, without reserving");
+			Report(std::format("FlatHashMap, {} keys: insert", count), flatInsert, "per key, without reserving");
+			Report(std::format("std::unordered_map, {} keys: find hit", count), unorderedHit, "per call");
+			Report(std::format("FlatHashMap, {} keys: find hit", count), flatHit, "per call");
+			Report(std::format("std::unordered_map, {} keys: find miss", count), unorderedMiss, "per call");
+			Report(std::format("FlatHashMap, {} keys: find miss", count), flatMiss, "per call");
+		}
+	}
+
+}
\ No newline at end of file
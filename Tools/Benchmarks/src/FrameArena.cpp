@@ -0,0 +1,82 @@
+#include "Benchmark.hpp"
+
+#include "Lumen/Internal/Renderer/FrameGraph.hpp"
+#include "Lumen/Internal/Renderer/RendererSpec.hpp"
+#include "Lumen/Internal/Vulkan/VulkanSynchronizer.hpp"
+
+#include <span>
+#include <array>
+#include <format>
+#include <cstdint>
+
+namespace
+{
+
+	using namespace Lumen::Internal;
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Settings
+	////////////////////////////////////////////////////////////////////////////////////
+	inline constexpr const size_t MinElements = 8;
+	inline constexpr const size_t MaxElements = 32;
+	inline constexpr const size_t WarmupFrames = 2 * RendererSpecification::MaxFramesInFlight * (MaxElements - MinElements + 1); // Note: Every frame slot sees every graph size it will ever get
+	inline constexpr const size_t MeasuredFrames = 10'000;
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Helpers
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: Same steps as the renderer's frame, minus the swapchain: reset the slot, build a graph in its arena & bake it
+	void RunFrame(VulkanSynchronizer& synchronizer, size_t frame)
+	{
+		const std::array<Waitable, 3> waits = { Waitable(WaitOperation::AcquireImage), Waitable(), Waitable() }; // Note: 3 spills the SmallVector into the arena
+
+		uint8_t index = static_cast<uint8_t>(frame % RendererSpecification::MaxFramesInFlight);
+		synchronizer.ResetFrame(index);
+
+		FrameGraph graph(&synchronizer.GetFrameArena(index));
+
+		size_t count = MinElements + (frame % (MaxElements - MinElements + 1));
+		for (size_t i = 0; i < count; i++)
+			graph.Elements.emplace_back(CommandBufferHandle(), Queue::Graphics, std::span<const Waitable>(waits.data(), i % (waits.size() + 1)));
+
+		synchronizer.BakeFrameGraph(graph, index);
+	}
+
+	uint64_t GetChunkAllocations(VulkanSynchronizer& synchronizer)
+	{
+		uint64_t allocations = 0;
+		for (uint8_t i = 0; i < RendererSpecification::MaxFramesInFlight; i++)
+			allocations += synchronizer.GetFrameArena(i).GetChunkAllocations();
+
+		return allocations;
+	}
+
+}
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Frame arena
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: Also checks that frame graphs stop touching the heap once every frame slot has warmed up,
+	//       without needing a window or LU_MEM_PROFILING, so it fails the run in every configuration.
+	void RunFrameArenaBenchmarks()
+	{
+		VulkanSynchronizer synchronizer;
+
+		for (size_t frame = 0; frame < WarmupFrames; frame++)
+			RunFrame(synchronizer, frame);
+
+		uint64_t before = GetChunkAllocations(synchronizer);
+		double frameTime = Measure(MeasuredFrames, [&](size_t frame) { RunFrame(synchronizer, frame); });
+		uint64_t after = GetChunkAllocations(synchronizer);
+
+		std::string name = std::format("Build & bake a frame graph, {}-{} elements", MinElements, MaxElements);
+		Report(name, frameTime, std::format("per frame, {} chunk allocations after warmup", after - before));
+
+		if (after != before)
+			Fail(name, "the frame arenas kept allocating after warmup");
+	}
+
+}
\ No newline at end of file
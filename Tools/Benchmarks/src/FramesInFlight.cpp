@@ -0,0 +1,112 @@
+#include "Benchmark.hpp"
+
+#include "Lumen/Internal/Core/Window.hpp"
+#include "Lumen/Internal/Renderer/RendererSpec.hpp"
+
+#include <span>
+#include <array>
+#include <format>
+#include <cstdint>
+#include <utility>
+#include <string_view>
+
+namespace
+{
+
+	using namespace Lumen;
+	using namespace Lumen::Internal;
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Settings
+	////////////////////////////////////////////////////////////////////////////////////
+	inline constexpr const size_t WarmupFrames = 60;
+	inline constexpr const size_t MeasuredFrames = 600;
+	inline constexpr const double SimulatedCPUWork = 1'000'000.0; // Note: In nanoseconds, stands in for a frame's game logic
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Helpers
+	////////////////////////////////////////////////////////////////////////////////////
+	void RunFrame(Window& window)
+	{
+		window.PollEvents();
+
+		double start = Benchmarks::Now();
+		while ((Benchmarks::Now() - start) < SimulatedCPUWork) {}
+
+		Renderer& renderer = window.GetRenderer();
+		renderer.BeginFrame();
+		{
+			Waitable acquire(WaitOperation::AcquireImage);
+
+			FrameGraph graph = renderer.CreateFrameGraph();
+			graph.Elements.emplace_back(CommandBufferHandle(), Queue::Graphics, std::span<const Waitable>(&acquire, 1));
+			renderer.BakeCurrentFrameGraph(graph);
+		}
+		renderer.EndFrame();
+		renderer.Present();
+
+		window.SwapBuffers();
+	}
+
+	std::pair<double, double> MeasureFrames(Window& window) // Note: Returns nanoseconds per frame & the average latency in milliseconds
+	{
+		for (size_t i = 0; i < WarmupFrames; i++)
+			RunFrame(window);
+
+		double latency = 0.0;
+		double start = Benchmarks::Now();
+		for (size_t i = 0; i < MeasuredFrames; i++)
+		{
+			RunFrame(window);
+			latency += window.GetRenderer().GetLatencyStatistics().LastLatency;
+		}
+		double end = Benchmarks::Now();
+
+		return { (end - start) / static_cast<double>(MeasuredFrames), latency / static_cast<double>(MeasuredFrames) };
+	}
+
+}
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Frames in flight
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: Runs the renderer on a hidden window without vsync, so presentation never waits on the display.
+	//       The frames only acquire & present, so this measures the pacing of each setting, not GPU throughput.
+	void RunFramesInFlightBenchmarks()
+	{
+		Window window(WindowSpecification({
+			.Title = "Lumen Benchmarks",
+
+			.Width = 1280,
+			.Height = 720,
+			.Visible = false,
+
+			.EventCallback = [](Event&) -> void {},
+
+			.VSync = false,
+		}));
+
+		constexpr std::array<std::pair<LatencyMode, std::string_view>, 2> modes = { {
+			{ LatencyMode::Throughput, "Throughput" },
+			{ LatencyMode::Low, "Low" },
+		} };
+
+		Renderer& renderer = window.GetRenderer();
+		for (const auto& [mode, modeName] : modes)
+		{
+			renderer.SetLatencyMode(mode);
+
+			for (uint8_t frames = 1; frames <= RendererSpecification::MaxFramesInFlight; frames++)
+			{
+				renderer.SetFramesInFlight(frames);
+
+				auto [frameTime, latency] = MeasureFrames(window);
+				Report(std::format("{} latency, {} frame(s) in flight", modeName, frames), frameTime, std::format("per frame, {:.0f} fps, {:.2f}ms latency", 1'000'000'000.0 / frameTime, latency));
+			}
+		}
+	}
+
+}
\ No newline at end of file
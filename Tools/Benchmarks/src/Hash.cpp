@@ -0,0 +1,47 @@
+#include "Benchmark.hpp"
+
+#include "Lumen/Internal/Utils/Hash.hpp"
+
+#include <array>
+#include <vector>
+#include <format>
+#include <cstdint>
+#include <string_view>
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Hash
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: Compares Hash::Fast to fnv1a, which was the only runtime hash before. Long inputs
+	//       are also hashed with Hash::LongScalar, to show what the SIMD stripe path adds.
+	void RunHashBenchmarks()
+	{
+		using namespace Lumen::Internal;
+
+		constexpr std::array<size_t, 9> sizes = { 8, 16, 32, 64, 128, 256, 1024, 64 * 1024, 1024 * 1024 };
+		constexpr size_t bytesPerMeasure = 64 * 1024 * 1024;
+
+		std::vector<char> data(sizes.back() * 2); // Note: Any offset below sizes.back() leaves room for the largest input
+		for (size_t i = 0; i < data.size(); i++)
+			data[i] = static_cast<char>((i * 131) ^ (i >> 7));
+
+		std::cout << "  Hash::Long uses " << Hash::GetLongPath() << '\n';
+
+		for (size_t size : sizes)
+		{
+			size_t iterations = std::clamp<size_t>(bytesPerMeasure / size, 16, 1 << 22);
+
+			// Note: The offset changes per iteration, so the hashes can't be hoisted out of the loop
+			auto input = [&](size_t i) { return std::string_view(data.data() + ((i * 64) & (sizes.back() - 1)), size); };
+
+			ReportThroughput(std::format("fnv1a, {} bytes", size), Measure(iterations, [&](size_t i) { DoNotOptimize(Hash::fnv1a(input(i))); }), size);
+			ReportThroughput(std::format("Hash::Fast, {} bytes", size), Measure(iterations, [&](size_t i) { DoNotOptimize(Hash::Fast(input(i))); }), size);
+
+			if (size > Hash::LongThreshold)
+				ReportThroughput(std::format("Hash::LongScalar, {} bytes", size), Measure(iterations, [&](size_t i) { DoNotOptimize(Hash::LongScalar(input(i).data(), size, 0)); }), size);
+		}
+	}
+
+}
\ No newline at end of file
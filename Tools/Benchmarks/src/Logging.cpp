@@ -0,0 +1,100 @@
+#include "Benchmark.hpp"
+
+#include "Lumen/Internal/IO/Print.hpp"
+#include "Lumen/Internal/IO/Logger.hpp"
+
+#include <ctime>
+#include <chrono>
+#include <format>
+#include <iomanip>
+#include <sstream>
+#include <iostream>
+#include <streambuf>
+
+namespace
+{
+
+	using namespace Lumen;
+	using namespace Lumen::Internal;
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Helpers
+	////////////////////////////////////////////////////////////////////////////////////
+	class NullBuffer : public std::streambuf // Note: Keeps the console out of the measurement
+	{
+	protected:
+		int overflow(int c) override { return c; }
+		std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+	};
+
+	// Note: The synchronous Log::PrintLvl from before the asynchronous backend, kept for comparison
+	template<typename ...TArgs>
+	void PrintSynchronous(std::format_string<TArgs...> fmt, TArgs&&... args)
+	{
+		std::string time;
+		{
+			auto now = std::chrono::system_clock::now();
+			std::time_t nowTime = std::chrono::system_clock::to_time_t(now);
+			std::ostringstream oss;
+			oss << std::put_time(std::localtime(&nowTime), "%H:%M:%S");
+			time = oss.str();
+		}
+		std::string message = std::format("[{0}] [{1}]: {2}", time, "I", std::format(fmt, std::forward<TArgs>(args)...));
+
+		std::cout << Log::Colour::GreenFG << message << Log::Colour::Reset << '\n';
+	}
+
+	template<typename TFunc>
+	std::pair<double, double> MeasureBatches(size_t batch, TFunc&& func) // Note: Returns nanoseconds per call on the calling thread & until the output is written
+	{
+		double bestCall = std::numeric_limits<double>::max();
+		double bestTotal = std::numeric_limits<double>::max();
+		for (size_t repeat = 0; repeat < Benchmarks::Repeats; repeat++)
+		{
+			// Note: Batches stay below the ring's capacity, so producers never wait on the background thread
+			Log::Logger::Flush();
+
+			double start = Benchmarks::Now();
+			for (size_t i = 0; i < batch; i++)
+				func(i);
+			double end = Benchmarks::Now();
+
+			Log::Logger::Flush();
+			double flushed = Benchmarks::Now();
+
+			bestCall = std::min(bestCall, (end - start) / static_cast<double>(batch));
+			bestTotal = std::min(bestTotal, (flushed - start) / static_cast<double>(batch));
+		}
+
+		return { bestCall, bestTotal };
+	}
+
+}
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Logging
+	////////////////////////////////////////////////////////////////////////////////////
+	void RunLoggingBenchmarks()
+	{
+		constexpr size_t batch = Log::Logger::Capacity / 2;
+
+		Log::Logger::Flush();
+		NullBuffer null;
+		std::streambuf* console = std::cout.rdbuf(&null);
+
+		auto [synchronous, synchronousTotal] = MeasureBatches(batch, [](size_t i) { PrintSynchronous("Frame {0} took {1:.2f}ms on the {2} queue", i, 16.6, "graphics"); });
+		auto [asynchronous, asynchronousTotal] = MeasureBatches(batch, [](size_t i) { Log::PrintLvl<Log::Level::Info>("Frame {0} took {1:.2f}ms on the {2} queue", i, 16.6, "graphics"); });
+
+		Log::Logger::Flush();
+		std::cout.rdbuf(console);
+
+		Report("Synchronous PrintLvl (previous)", synchronous, "per call");
+		Report("Asynchronous PrintLvl, calling thread", asynchronous, "per call");
+		Report("Asynchronous PrintLvl, until written", asynchronousTotal, "per call, includes the background thread");
+		DoNotOptimize(synchronousTotal);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "Benchmark.hpp"
+
+#include <array>
+#include <iostream>
+#include <string_view>
+
+using namespace Lumen::Benchmarks;
+
+namespace
+{
+
+	struct Suite
+	{
+	public:
+		std::string_view Name;
+		void (*Run)() = nullptr;
+	};
+
+	inline constexpr const std::array s_Suites = {
+		Suite{ "Events", &RunEventBenchmarks },
+		Suite{ "Logging", &RunLoggingBenchmarks },
+		Suite{ "BinaryLogging", &RunBinaryLoggingBenchmarks },
+		Suite{ "Enum", &RunEnumBenchmarks },
+		Suite{ "EnumReflection", &RunEnumReflectionBenchmarks },
+		Suite{ "Hash", &RunHashBenchmarks },
+		Suite{ "FlatHashMap", &RunFlatHashMapBenchmarks },
+		Suite{ "Random", &RunRandomBenchmarks },
+		Suite{ "FrameArena", &RunFrameArenaBenchmarks },
+		Suite{ "FramesInFlight", &RunFramesInFlightBenchmarks },
+	};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Main
+////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+	// Note: Pass part of a suite's name to only run the matching suites
+	std::string_view filter = ((argc >= 2) ? argv[1] : "");
+
+	for (const Suite& suite : s_Suites)
+	{
+		if (!filter.empty() && (suite.Name.find(filter) == std::string_view::npos))
+			continue;
+
+		Header(suite.Name);
+		suite.Run();
+	}
+
+	return (g_Failed ? 1 : 0);
+}
\ No newline at end of file
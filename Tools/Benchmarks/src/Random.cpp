@@ -0,0 +1,39 @@
+#include "Benchmark.hpp"
+
+#include "Lumen/Utils/Random.hpp"
+
+#include <vector>
+#include <cstdint>
+
+namespace Lumen::Benchmarks
+{
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Random
+	////////////////////////////////////////////////////////////////////////////////////
+	// Note: Fills 16M values with Random (mt19937), FastRandom per call & FastRandom::Fill
+	void RunRandomBenchmarks()
+	{
+		constexpr size_t count = 16 * 1024 * 1024;
+		constexpr double perValue = 1.0 / static_cast<double>(count);
+
+		Random::Seed(1);
+		FastRandom::Seed(1);
+
+		std::vector<float> floats(count);
+		Report("Random::Float", Measure(1, [&](size_t) { for (float& value : floats) value = Random::Float(); DoNotOptimize(floats.data()); }) * perValue, "per value");
+		Report("FastRandom::Float", Measure(1, [&](size_t) { for (float& value : floats) value = FastRandom::Float(); DoNotOptimize(floats.data()); }) * perValue, "per value");
+		Report("FastRandom::Fill (float)", Measure(1, [&](size_t) { FastRandom::Fill(floats); DoNotOptimize(floats.data()); }) * perValue, "per value");
+
+		std::vector<uint32_t> uints(count);
+		Report("Random::UInt (0, 999)", Measure(1, [&](size_t) { for (uint32_t& value : uints) value = Random::UInt(0, 999); DoNotOptimize(uints.data()); }) * perValue, "per value");
+		Report("FastRandom::UInt (0, 999)", Measure(1, [&](size_t) { for (uint32_t& value : uints) value = FastRandom::UInt(0, 999); DoNotOptimize(uints.data()); }) * perValue, "per value");
+		Report("FastRandom::Fill (uint32_t, 0, 999)", Measure(1, [&](size_t) { FastRandom::Fill(uints, 0, 999); DoNotOptimize(uints.data()); }) * perValue, "per value");
+
+		std::vector<double> doubles(count);
+		Report("Random::Double", Measure(1, [&](size_t) { for (double& value : doubles) value = Random::Double(); DoNotOptimize(doubles.data()); }) * perValue, "per value");
+		Report("FastRandom::Double", Measure(1, [&](size_t) { for (double& value : doubles) value = FastRandom::Double(); DoNotOptimize(doubles.data()); }) * perValue, "per value");
+		Report("FastRandom::Fill (double)", Measure(1, [&](size_t) { FastRandom::Fill(doubles); DoNotOptimize(doubles.data()); }) * perValue, "per value");
+	}
+
+}
\ No newline at end of file
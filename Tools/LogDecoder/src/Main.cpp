@@ -0,0 +1,311 @@
+#include "Lumen/Internal/IO/BinaryLog.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+using namespace Lumen::Internal::Log;
+
+namespace
+{
+
+	using Argument = std::variant<bool, char, int64_t, uint64_t, double, const void*, std::string_view>;
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Reader
+	////////////////////////////////////////////////////////////////////////////////////
+	class Reader
+	{
+	public:
+		// Constructor & Destructor
+		Reader(const std::byte* data, size_t size)
+			: m_Data(data), m_Size(size) {}
+		~Reader() = default;
+
+		// Methods
+		template<typename T>
+		bool Read(T& value)
+		{
+			if (m_Offset + sizeof(T) > m_Size)
+				return false;
+
+			std::memcpy(&value, m_Data + m_Offset, sizeof(T));
+			m_Offset += sizeof(T);
+			return true;
+		}
+
+		bool Read(std::string_view& value, size_t length)
+		{
+			if (m_Offset + length > m_Size)
+				return false;
+
+			value = std::string_view(reinterpret_cast<const char*>(m_Data + m_Offset), length);
+			m_Offset += length;
+			return true;
+		}
+
+	private:
+		const std::byte* m_Data;
+		size_t m_Size;
+		size_t m_Offset = 0;
+	};
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Helper functions
+	////////////////////////////////////////////////////////////////////////////////////
+	bool ReadArgument(Reader& reader, Argument& argument)
+	{
+		Binary::ArgumentType type = {};
+		if (!reader.Read(type))
+			return false;
+
+		switch (type)
+		{
+		case Binary::ArgumentType::Bool:
+		{
+			uint8_t value = 0;
+			return reader.Read(value) && ((argument = static_cast<bool>(value)), true);
+		}
+		case Binary::ArgumentType::Char:
+		{
+			char value = 0;
+			return reader.Read(value) && ((argument = value), true);
+		}
+		case Binary::ArgumentType::Int:
+		{
+			int64_t value = 0;
+			return reader.Read(value) && ((argument = value), true);
+		}
+		case Binary::ArgumentType::UInt:
+		{
+			uint64_t value = 0;
+			return reader.Read(value) && ((argument = value), true);
+		}
+		case Binary::ArgumentType::Float:
+		{
+			double value = 0.0;
+			return reader.Read(value) && ((argument = value), true);
+		}
+		case Binary::ArgumentType::Pointer:
+		{
+			uint64_t value = 0;
+			return reader.Read(value) && ((argument = reinterpret_cast<const void*>(static_cast<uintptr_t>(value))), true);
+		}
+		case Binary::ArgumentType::String:
+		{
+			uint32_t length = 0;
+			std::string_view value = {};
+			return reader.Read(length) && reader.Read(value, length) && ((argument = value), true);
+		}
+		case Binary::ArgumentType::Null:
+		{
+			argument = std::string_view("(null)");
+			return true;
+		}
+
+		default:
+			break;
+		}
+
+		return false;
+	}
+
+	std::string FormatArgument(const Argument& argument, std::string_view spec)
+	{
+		return std::visit([&](const auto& value) -> std::string
+		{
+			try
+			{
+				return std::vformat(std::format("{{:{}}}", spec), std::make_format_args(value));
+			}
+			catch (const std::format_error&)
+			{
+				// Note: The spec was validated against the original type, which might not match the decoded type
+				return std::format("{}", value);
+			}
+		}, argument);
+	}
+
+	// Note: std::vformat needs the argument count at compile time, so the replacement fields are resolved by hand
+	std::string Format(std::string_view format, const std::vector<Argument>& arguments)
+	{
+		std::string result;
+		result.reserve(format.size());
+
+		size_t automatic = 0;
+		for (size_t i = 0; i < format.size(); i++)
+		{
+			char c = format[i];
+
+			if ((c == '{' || c == '}') && (i + 1 < format.size()) && (format[i + 1] == c))
+			{
+				result += c;
+				i++;
+				continue;
+			}
+			if (c != '{')
+			{
+				result += c;
+				continue;
+			}
+
+			size_t end = format.find('}', i);
+			if (end == std::string_view::npos)
+			{
+				result += format.substr(i);
+				break;
+			}
+
+			std::string_view field = format.substr(i + 1, end - i - 1);
+			std::string_view index = field.substr(0, field.find(':'));
+			std::string_view spec = (index.size() < field.size()) ? field.substr(index.size() + 1) : std::string_view();
+
+			size_t argument = automatic++;
+			if (!index.empty())
+				argument = static_cast<size_t>(std::strtoull(std::string(index).c_str(), nullptr, 10));
+
+			if (argument < arguments.size())
+				result += FormatArgument(arguments[argument], spec);
+			else
+				result += format.substr(i, end - i + 1);
+
+			i = end;
+		}
+
+		return result;
+	}
+
+	std::string FormatTime(uint64_t timestamp)
+	{
+		std::time_t seconds = static_cast<std::time_t>(timestamp / 1'000'000'000ull);
+		uint64_t milliseconds = (timestamp / 1'000'000ull) % 1000;
+
+		std::tm time = {};
+		#if defined(LU_PLATFORM_WINDOWS)
+			localtime_s(&time, &seconds);
+		#else
+			localtime_r(&seconds, &time);
+		#endif
+
+		char buffer[16] = {};
+		std::strftime(buffer, sizeof(buffer), "%H:%M:%S", &time);
+
+		return std::format("{}.{:03}", buffer, milliseconds);
+	}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Main
+////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: LogDecoder <file.lublog>\n";
+		return 1;
+	}
+
+	std::ifstream file(argv[1], std::ios::binary);
+	if (!file)
+	{
+		std::cerr << std::format("Failed to open '{}'.\n", argv[1]);
+		return 1;
+	}
+
+	std::vector<char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	const std::byte* data = reinterpret_cast<const std::byte*>(contents.data());
+
+	Binary::FileHeader fileHeader = {};
+	if (contents.size() >= sizeof(fileHeader))
+		std::memcpy(&fileHeader, data, sizeof(fileHeader));
+
+	if (std::memcmp(fileHeader.Magic, Binary::Magic, sizeof(Binary::Magic)) != 0)
+	{
+		std::cerr << std::format("'{}' is not a binary log.\n", argv[1]);
+		return 1;
+	}
+	if (fileHeader.Version != Binary::Version)
+	{
+		std::cerr << std::format("Unsupported binary log version {}, expected {}.\n", fileHeader.Version, Binary::Version);
+		return 1;
+	}
+
+	std::unordered_map<uint32_t, std::string_view> formats = { };
+	std::vector<Argument> arguments = { };
+
+	size_t incomplete = 0;
+	size_t offset = fileHeader.HeaderSize;
+	while (offset + sizeof(Binary::RecordHeader) <= contents.size())
+	{
+		Binary::RecordHeader header = {};
+		std::memcpy(&header, data + offset, sizeof(header));
+
+		// Note: Without a valid length the record's reservation was never written (or the rest of the file is unused),
+		//       records are 8 byte aligned, so scan ahead for the next valid one
+		if ((header.Length < sizeof(header)) || ((header.Length & 7u) != 0) || (offset + header.Length > contents.size()))
+		{
+			offset += 8;
+			continue;
+		}
+
+		// Note: Reserved but never committed, e.g. the writer crashed
+		if (header.Size != header.Length)
+		{
+			incomplete++;
+			offset += header.Length;
+			continue;
+		}
+
+		Reader reader(data + offset + sizeof(header), header.Size - sizeof(header));
+		offset += header.Size;
+
+		uint32_t id = 0;
+		if (!reader.Read(id))
+			continue;
+
+		if (header.Type == Binary::RecordType::Format)
+		{
+			std::string_view format = {};
+			if (reader.Read(format, header.Count))
+				formats[id] = format;
+
+			continue;
+		}
+		if (header.Type != Binary::RecordType::Message)
+			continue;
+
+		uint64_t timestamp = 0;
+		if (!reader.Read(timestamp))
+			continue;
+
+		arguments.clear();
+		for (uint16_t i = 0; i < header.Count; i++)
+		{
+			Argument argument = {};
+			if (!ReadArgument(reader, argument))
+				break;
+
+			arguments.push_back(argument);
+		}
+
+		auto it = formats.find(id);
+		std::string message = (it != formats.end()) ? Format(it->second, arguments) : std::format("<unknown format {}>", id);
+
+		std::cout << std::format("[{}] {}\n", FormatTime(timestamp), message);
+	}
+
+	if (incomplete > 0)
+		std::cerr << std::format("Skipped {} incomplete records.\n", incomplete);
+
+	return 0;
+}
\ No newline at end of file
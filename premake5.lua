@@ -143,4 +143,9 @@ group "Lumen"
 group ""
 
 include "Sandbox"
+
+group "Tools"
+	include "Tools/LogDecoder"
+	include "Tools/Benchmarks"
+group ""
 ------------------------------------------------------------------------------
\ No newline at end of file